@@ -1,7 +1,10 @@
 // Copyright Sharundaar. All Rights Reserved.
 
 #include "UIDatasource.h"
+#include "UIDatasourceStructMapping.h"
 #include "UIDatasourceSubsystem.h"
+#include "Hash/xxhash.h"
+#include "UObject/UnrealType.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UIDatasource)
 
@@ -45,6 +48,91 @@ void FUIDatasource::GetPath(FString& OutPath)
 	}
 }
 
+bool FUIDatasource::SetInterned(FStringView InValue)
+{
+	if(UNLIKELY(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink)))
+	{
+		return false;
+	}
+
+	FUIDatasourceStringTable& Strings = GetPool()->GetStringTable();
+	const FUIDatasourceInternedString* CurrentValue = Value.Value.TryGet<FUIDatasourceInternedString>();
+	if(CurrentValue && Strings.Resolve(*CurrentValue).Equals(InValue, ESearchCase::CaseSensitive))
+	{
+		return false; // Early out before touching the table, avoids an intern/release round trip on redundant writes
+	}
+
+	const FUIDatasourceInternedString PreviousValue = CurrentValue ? *CurrentValue : FUIDatasourceInternedString();
+	const FUIDatasourceInternedString NewValue = Strings.Intern(InValue);
+	if(!SetInternal<FUIDatasourceInternedString>(NewValue))
+	{
+		Strings.Release(NewValue);
+		return false;
+	}
+
+	Strings.Release(PreviousValue);
+	return true;
+}
+
+FStringView FUIDatasource::GetInterned() const
+{
+	const FUIDatasourceInternedString* CurrentValue = Value.Value.TryGet<FUIDatasourceInternedString>();
+	return CurrentValue ? GetPool()->GetStringTable().Resolve(*CurrentValue) : FStringView();
+}
+
+bool FUIDatasource::SetString(FString InValue)
+{
+	if(Value.Value.IsType<FUIDatasourceInternedString>())
+	{
+		return SetInterned(InValue);
+	}
+	return Set<FString>(MoveTemp(InValue));
+}
+
+bool FUIDatasource::TryGetString(FString& OutValue) const
+{
+	if(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink))
+	{
+		return false;
+	}
+	
+	if(const FUIDatasourceInternedString* CurrentValue = Value.Value.TryGet<FUIDatasourceInternedString>())
+	{
+		OutValue.Reset();
+		OutValue.Append(GetPool()->GetStringTable().Resolve(*CurrentValue));
+		return true;
+	}
+	return Value.TryGet<FString>(OutValue);
+}
+
+void FUIDatasource::SetFromStruct(const UScriptStruct* Struct, const void* StructData)
+{
+	if(!Struct || !StructData)
+	{
+		return;
+	}
+	FUIDatasourceStructMapping::Get(Struct).Write(this, StructData);
+}
+
+bool FUIDatasource::ReadIntoStruct(const UScriptStruct* Struct, void* StructData, FUIDatasourceStructReadResult* OutResult) const
+{
+	if(!Struct || !StructData || EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink))
+	{
+		return false;
+	}
+
+	FUIDatasourceStructReadResult Result;
+	TArray<FName, TInlineAllocator<8>> PathStack;
+	FUIDatasourceStructMapping::Get(Struct).Read(this, StructData, PathStack, Result);
+
+	const bool bIsComplete = Result.IsComplete();
+	if(OutResult)
+	{
+		*OutResult = MoveTemp(Result);
+	}
+	return bIsComplete;
+}
+
 #define OPERATOR_IMPL(Type, Func, IS_CONST) \
 FUIDatasource& FUIDatasource::operator[](Type Path) IS_CONST \
 { \
@@ -64,6 +152,12 @@ void FUIDatasource::OnValueChanged() const
 {
 	UIDATASOURCE_FUNC_TRACE()
 
+	if(UNLIKELY(GetPool()->IsStaging()))
+	{
+		return; // Staged datasources aren't observable until committed, and might be written from a worker thread
+	}
+	GetPool()->StampVersion(this);
+
 #if WITH_UIDATASOURCE_MONITOR
 	UUIDatasourceSubsystem::Get()->Monitor.QueueDatasourceEvent({
 		EUIDatasourceChangeEventKind::ValueSet,
@@ -74,6 +168,233 @@ void FUIDatasource::OnValueChanged() const
 		EUIDatasourceChangeEventKind::ValueSet,
 		this
 	});
+	OnDatasourceChangedNative.Broadcast({
+		EUIDatasourceChangeEventKind::ValueSet,
+		this
+	});
+#endif
+}
+
+static bool HashStructMemory(const UScriptStruct* Struct, const void* Memory, FXxHash64Builder& Builder);
+
+// Field by field so padding never gets in, values equal under the struct compare hash the same: -0 and 0 hash alike and so
+// do every NaN. Properties we can't hash exactly fail the whole hash instead of falling back on their lossy 32 bit value hash.
+static bool HashPropertyElement(const FProperty* Property, const void* ElementPtr, FXxHash64Builder& Builder)
+{
+	if(const FFloatProperty* FloatProperty = CastField<FFloatProperty>(Property))
+	{
+		// Bit level so fast math can't fold the normalization away
+		const float Value = FloatProperty->GetPropertyValue(ElementPtr);
+		const uint32 Bits = FMath::IsNaN(Value) ? 0x7FC00000u : (Value == 0.f ? 0u : BitCast<uint32>(Value));
+		Builder.Update(&Bits, sizeof(Bits));
+	}
+	else if(const FDoubleProperty* DoubleProperty = CastField<FDoubleProperty>(Property))
+	{
+		const double Value = DoubleProperty->GetPropertyValue(ElementPtr);
+		const uint64 Bits = FMath::IsNaN(Value) ? 0x7FF8000000000000ull : (Value == 0.0 ? 0ull : BitCast<uint64>(Value));
+		Builder.Update(&Bits, sizeof(Bits));
+	}
+	else if(const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		const uint8 Value = BoolProperty->GetPropertyValue(ElementPtr) ? 1 : 0; // Bitfields share their byte with other fields
+		Builder.Update(&Value, sizeof(Value));
+	}
+	else if(CastField<FNumericProperty>(Property) || CastField<FEnumProperty>(Property) || (CastField<FObjectPropertyBase>(Property) && !CastField<FSoftObjectProperty>(Property) && !CastField<FLazyObjectProperty>(Property)))
+	{
+		Builder.Update(ElementPtr, Property->GetElementSize()); // Integers and object pointers, no padding in a single value
+	}
+	else if(const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		const FName Name = NameProperty->GetPropertyValue(ElementPtr);
+		const uint32 NameParts[] = { Name.GetComparisonIndex().ToUnstableInt(), static_cast<uint32>(Name.GetNumber()) };
+		Builder.Update(NameParts, sizeof(NameParts));
+	}
+	else if(const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+	{
+		const FString& String = StrProperty->GetPropertyValue(ElementPtr);
+		const int32 Len = String.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(*String, Len * sizeof(TCHAR));
+	}
+	else if(const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		const FString& String = TextProperty->GetPropertyValue(ElementPtr).ToString();
+		const int32 Len = String.Len();
+		Builder.Update(&Len, sizeof(Len));
+		Builder.Update(*String, Len * sizeof(TCHAR));
+	}
+	else if(const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		return HashStructMemory(StructProperty->Struct, ElementPtr, Builder);
+	}
+	else if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, ElementPtr);
+		const int32 Num = ArrayHelper.Num();
+		Builder.Update(&Num, sizeof(Num));
+		for(int32 Index = 0; Index < Num; ++Index)
+		{
+			if(!HashPropertyElement(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), Builder))
+			{
+				return false;
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+static bool HashStructMemory(const UScriptStruct* Struct, const void* Memory, FXxHash64Builder& Builder)
+{
+	for(TFieldIterator<FProperty> PropertyIt(Struct); PropertyIt; ++PropertyIt)
+	{
+		const FProperty* Property = *PropertyIt;
+		for(int32 Index = 0; Index < Property->ArrayDim; ++Index)
+		{
+			if(!HashPropertyElement(Property, Property->ContainerPtrToValuePtr<void>(Memory, Index), Builder))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool FUIDatasource::HashStructValue(const FInstancedStruct& InValue, uint64& OutHash)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	const UScriptStruct* Struct = InValue.GetScriptStruct();
+	const uint8* Memory = InValue.GetMemory();
+	if(!Struct || !Memory)
+	{
+		OutHash = 0;
+		return true;
+	}
+
+	FXxHash64Builder Builder;
+	if(!HashStructMemory(Struct, Memory, Builder))
+	{
+		return false;
+	}
+	OutHash = Builder.Finalize().Hash;
+	return true;
+}
+
+bool FUIDatasource::IsUnchangedHashedStruct(const FInstancedStruct& NewValue, uint64& OutNewHash) const
+{
+	const FInstancedStruct* CurrentValue = Value.Value.TryGet<FInstancedStruct>();
+	if(!HashStructValue(NewValue, OutNewHash))
+	{
+		// Not exactly hashable, compare the values instead
+		OutNewHash = 0;
+		return CurrentValue && *CurrentValue == NewValue;
+	}
+	
+	if(!CurrentValue)
+	{
+		return false;
+	}
+	if(!NewValue.IsValid())
+	{
+		return !CurrentValue->IsValid(); // Empty values hash to 0, which is also the unknown hash
+	}
+	
+	// @NOTE: Equal hashes are trusted without comparing the values, two different values colliding on 64 bits (about 1 in 2^64)
+	// would skip that change. Values set before the flag got added have no stored hash and always count as changed.
+	const uint64 CurrentHash = GetPool()->FindStructHash(this);
+	return CurrentHash != 0 && CurrentHash == OutNewHash;
+}
+
+void FUIDatasource::StoreStructHash(uint64 Hash) const
+{
+	GetPool()->SetStructHash(this, Hash);
+}
+
+void FUIDatasource::OnStructValueChanging(const FInstancedStruct& NewValue) const
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+#if WITH_UIDATASOURCE_MONITOR
+	if(LIKELY(!GetPool()->IsStaging()))
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.QueueFieldEvents(this, Value.Value.TryGet<FInstancedStruct>(), NewValue);
+	}
+#endif
+}
+
+bool FUIDatasource::PassesChangePolicy(double NewValue) const
+{
+	const FUIDatasourceChangePolicy* Policy = GetPool()->FindChangePolicy(this);
+	if(!Policy)
+	{
+		return true;
+	}
+
+	if(const float* CurrentFloat = Value.Value.TryGet<float>())
+	{
+		return Policy->IsSignificantChange(*CurrentFloat, NewValue);
+	}
+	if(const double* CurrentDouble = Value.Value.TryGet<double>())
+	{
+		return Policy->IsSignificantChange(*CurrentDouble, NewValue);
+	}
+	return true; // First write, or a type the policy doesn't apply to
+}
+
+bool FUIDatasourceChangePolicy::IsSignificantChange(double OldValue, double NewValue) const
+{
+	if(!FMath::IsFinite(OldValue) || !FMath::IsFinite(NewValue))
+	{
+		return OldValue != NewValue;
+	}
+
+	switch(Mode)
+	{
+	case EUIDatasourceChangePolicyMode::AbsoluteEpsilon:
+		return FMath::Abs(NewValue - OldValue) > Epsilon;
+	case EUIDatasourceChangePolicyMode::RelativeEpsilon:
+		return FMath::Abs(NewValue - OldValue) > Epsilon * FMath::Max(FMath::Abs(OldValue), FMath::Abs(NewValue));
+	case EUIDatasourceChangePolicyMode::Quantize:
+		if(Steps > 0 && RangeMax > RangeMin)
+		{
+			const auto GetStep = [this](double Value)
+			{
+				return FMath::FloorToInt64(FMath::Clamp((Value - RangeMin) / (RangeMax - RangeMin), 0.0, 1.0) * Steps);
+			};
+			return GetStep(OldValue) != GetStep(NewValue);
+		}
+		return OldValue != NewValue;
+	default:
+		return OldValue != NewValue;
+	}
+}
+
+int32 FUIDatasource::GetObserverCount() const
+{
+#if WITH_UIDATASOURCE_MONITOR
+	return ObserverCount;
+#else
+	return OnDatasourceChanged.IsBound() || OnDatasourceChangedNative.IsBound() ? 1 : 0;
+#endif
+}
+
+int32 FUIDatasource::GetSubtreeObserverCount() const
+{
+#if WITH_UIDATASOURCE_MONITOR
+	return SubtreeObserverCount;
+#else
+	return GetObserverCount();
+#endif
+}
+
+void FUIDatasource::PullProvider()
+{
+#if WITH_UIDATASOURCE_MONITOR
+	UUIDatasourceSubsystem::Get()->Monitor.PullProvider(this);
 #endif
 }
 
@@ -103,6 +424,7 @@ FUIDatasource* FUIArrayDatasource::AppendFront()
 	const FName ChildName = UIDatasourceHelpers::GetDisplayName(ItemBaseName, Num);
 	if(FUIDatasource* Child = Pool->FindOrCreateChildDatasource(this, ChildName))
 	{
+		Pool->BeginStructureWrite(); // Renaming children, concurrent lookups need to know
 		for(FUIDatasource* ChildIt = Pool->GetDatasourceById(FirstChild); ChildIt; ChildIt = Pool->GetDatasourceById(ChildIt->NextSibling))
 		{
 			if (ChildIt->Name.IsEqual(ItemBaseName, ENameCase::IgnoreCase, false))
@@ -111,6 +433,7 @@ FUIDatasource* FUIArrayDatasource::AppendFront()
 			}
 		}
 		Child->Name = UIDatasourceHelpers::GetDisplayName(ItemBaseName, 0);
+		Pool->EndStructureWrite();
 		
 		Set(Num + 1);
 		return Child;
@@ -118,6 +441,66 @@ FUIDatasource* FUIArrayDatasource::AppendFront()
 	return nullptr; // @NOTE: Pool is full...
 }
 
+bool FUIArrayDatasource::AppendN(int32 Count, TArray<FUIDatasource*>* OutItems)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	if(OutItems)
+	{
+		OutItems->Reset();
+	}
+	
+	if(UNLIKELY(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink)))
+	{
+		return false;
+	}
+	
+	if(Count <= 0)
+	{
+		return true;
+	}
+	
+	FUIDatasourcePool* Pool = GetPool();
+	const int32 Num = GetNum();
+
+	// Single pass over the children to find items left over by a previous Empty, instead of one lookup per item
+	TArray<FUIDatasource*> Items;
+	Items.SetNumZeroed(Count);
+	int32 MissingCount = Count;
+	for(FUIDatasource* ChildIt = Pool->GetDatasourceById(FirstChild); ChildIt; ChildIt = Pool->GetDatasourceById(ChildIt->NextSibling))
+	{
+		const int32 ItemIndex = ChildIt->Name.GetNumber() - 1 - Num;
+		if(0 <= ItemIndex && ItemIndex < Count && ChildIt->Name.IsEqual(ItemBaseName, ENameCase::IgnoreCase, false) && !Items[ItemIndex])
+		{
+			Items[ItemIndex] = ChildIt;
+			MissingCount--;
+		}
+	}
+
+	if(FUIDatasourcePool::Capacity() - Pool->Num() < MissingCount)
+	{
+		UE_LOG(LogDatasource, Error, TEXT("Not enough room to append %d items to array datasource %s, consider cleaning unused Datasource or increase pool size."), Count, *Name.ToString());
+		return false;
+	}
+
+	Pool->BeginStructureWrite();
+	for(int32 ItemIndex = 0; ItemIndex < Count; ++ItemIndex)
+	{
+		if(!Items[ItemIndex])
+		{
+			Items[ItemIndex] = Pool->CreateChildDatasource(this, UIDatasourceHelpers::GetDisplayName(ItemBaseName, Num + ItemIndex));
+		}
+	}
+	Pool->EndStructureWrite();
+
+	Set(Num + Count);
+	if(OutItems)
+	{
+		*OutItems = MoveTemp(Items);
+	}
+	return true;
+}
+
 void FUIArrayDatasource::Empty(bool bDestroyChildren)
 {
 	if(bDestroyChildren)
@@ -3,6 +3,7 @@
 #include "UIDatasourceArchetype.h"
 
 #include "UIDatasourceSubsystem.h"
+#include "UObject/ObjectSaveContext.h"
 #include "UObject/UObjectIterator.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UIDatasourceArchetype)
@@ -11,6 +12,55 @@ TArray<FName> UUIDatasourceArchetype::MockNameSource = { "Name1", "Name2", "Name
 TArray<FString> UUIDatasourceArchetype::MockStringSource = { TEXT("String1"), TEXT("String2"), TEXT("String3") };
 TArray<FText> UUIDatasourceArchetype::MockTextSource = { INVTEXT("Text1"), INVTEXT("Text2"), INVTEXT("Text3") };
 
+static void SetDefaultValue(FUIDatasource* Datasource, EUIDatasourceValueType Type)
+{
+	switch(Type)
+	{
+	case EUIDatasourceValueType::Void: break;
+	case EUIDatasourceValueType::Int:
+	case EUIDatasourceValueType::Enum:
+		Datasource->Set<int32>({});
+		break;
+	case EUIDatasourceValueType::Float:
+		Datasource->Set<float>({});
+		break;
+	case EUIDatasourceValueType::Bool:
+		Datasource->Set<bool>({});
+		break;
+	case EUIDatasourceValueType::Name:
+		Datasource->Set<FName>({});
+		break;
+	case EUIDatasourceValueType::Text:
+		Datasource->Set<FText>({});
+		break;
+	case EUIDatasourceValueType::String:
+		Datasource->Set<FString>({});
+		break;
+	case EUIDatasourceValueType::Image:
+		Datasource->Set<FUIDatasourceImage>({});
+		break;
+	case EUIDatasourceValueType::GameplayTag:
+		Datasource->Set<FGameplayTag>({});
+		break;
+	case EUIDatasourceValueType::Struct:
+		Datasource->Set<FInstancedStruct>({});
+		break;
+	case EUIDatasourceValueType::Vector2D:
+		Datasource->Set<FVector2D>(FVector2D::ZeroVector);
+		break;
+	case EUIDatasourceValueType::LinearColor:
+		Datasource->Set<FLinearColor>(FLinearColor::White);
+		break;
+	case EUIDatasourceValueType::Int64:
+		Datasource->Set<int64>({});
+		break;
+	case EUIDatasourceValueType::Double:
+		Datasource->Set<double>({});
+		break;
+	default: ;
+	}
+}
+
 void UUIDatasourceArchetype::MockDatasource(FUIDatasource* Datasource) const
 {
 	if(!Datasource)
@@ -43,6 +93,7 @@ void UUIDatasourceArchetype::MockDatasource(FUIDatasource* Datasource) const
 				}
 				break;
 			case EUIDatasourceValueType::Float:
+				Pool->SetChangePolicy(ChildDatasource, Descriptor.ChangePolicy);
 				ChildDatasource->Set<float>(FMath::FRandRange(0.0f, 1.0f));
 				break;
 			case EUIDatasourceValueType::Bool:
@@ -64,8 +115,25 @@ void UUIDatasourceArchetype::MockDatasource(FUIDatasource* Datasource) const
 				ChildDatasource->Set<FGameplayTag>({});
 				break;
 			case EUIDatasourceValueType::Struct:
+				if(Descriptor.bHashStructValue)
+				{
+					EnumAddFlags(ChildDatasource->Flags, EUIDatasourceFlag::HashStructValues);
+				}
 				ChildDatasource->Set<FInstancedStruct>({});
 				break;
+			case EUIDatasourceValueType::Vector2D:
+				ChildDatasource->Set<FVector2D>(FVector2D(FMath::FRandRange(0.0, 100.0), FMath::FRandRange(0.0, 100.0)));
+				break;
+			case EUIDatasourceValueType::LinearColor:
+				ChildDatasource->Set<FLinearColor>(FLinearColor::MakeRandomColor());
+				break;
+			case EUIDatasourceValueType::Int64:
+				ChildDatasource->Set<int64>(FMath::RandHelper64(100));
+				break;
+			case EUIDatasourceValueType::Double:
+				Pool->SetChangePolicy(ChildDatasource, Descriptor.ChangePolicy);
+				ChildDatasource->Set<double>(FMath::FRandRange(0.0, 1.0));
+				break;
 			case EUIDatasourceValueType::Archetype:
 				if(Descriptor.Archetype)
 				{
@@ -75,7 +143,21 @@ void UUIDatasourceArchetype::MockDatasource(FUIDatasource* Datasource) const
 						Descriptor.Archetype->MockDatasource(ChildDatasource);
 						break;
 					case EUIDatasourceArchetypeImportMethod::AsArray:
-						// @TODO: Build array datasource structure
+						if(Descriptor.Archetype->ImportsArchetype(this))
+						{
+							UE_LOG(LogDatasource, Error, TEXT("Archetype %s imports itself, skipping recursive import."), *GetPathName());
+						}
+						else
+						{
+							TArray<FUIDatasource*> Items;
+							if(FUIArrayDatasource::Make(ChildDatasource)->AppendN(Descriptor.InitialCount, &Items))
+							{
+								for(FUIDatasource* Item : Items)
+								{
+									Descriptor.Archetype->MockDatasource(Item);
+								}
+							}
+						}
 						break;
 					default: ;
 					}
@@ -89,73 +171,80 @@ void UUIDatasourceArchetype::MockDatasource(FUIDatasource* Datasource) const
 
 void UUIDatasourceArchetype::GenerateDatasource(FUIDatasource* Datasource) const
 {
+	UIDATASOURCE_FUNC_TRACE();
+	
 	if(!Datasource)
 	{
 		return;
 	}
-	
+
+	// Check the whole instance fits up front, a generation running out of room halfway leaves a partially built datasource behind
+	const int32 NodeCount = GetInstanceNodeCount();
 	FUIDatasourcePool* Pool = Datasource->GetPool();
-	for(const FUIDatasourceDescriptor& Descriptor : Children)
+	if(FUIDatasourcePool::Capacity() - Pool->Num() < NodeCount)
 	{
-		if(Descriptor.IsInlineArchetype())
+		UE_LOG(LogDatasource, Error, TEXT("Not enough room to generate %d datasources from archetype %s under %s, consider cleaning unused Datasource or increase pool size."), NodeCount, *GetName(), *Datasource->Name.ToString());
+		return;
+	}
+	
+	InstantiateLayout(Datasource);
+}
+
+int32 UUIDatasourceArchetype::GetInstanceNodeCount() const
+{
+	const FUIDatasourceArchetypeLayout& CompiledLayout = GetLayout();
+	int32 NodeCount = 0;
+	for(const FUIDatasourceArchetypeLayoutNode& Node : CompiledLayout.Nodes)
+	{
+		// The root node is the datasource the layout is generated under
+		if(Node.Parent != INDEX_NONE)
 		{
-			Descriptor.Archetype->GenerateDatasource(Datasource);
+			NodeCount++;
 		}
-		else
+		if(Node.bIsArray && Node.InitialCount > 0)
 		{
-			
-			FUIDatasource* ChildDatasource = Pool->FindOrCreateDatasource(Datasource, *Descriptor.Path);
-			switch(Descriptor.Type)
+			NodeCount += Node.InitialCount * (1 + (Node.ItemArchetype ? Node.ItemArchetype->GetInstanceNodeCount() : 0));
+		}
+	}
+	return NodeCount;
+}
+
+void UUIDatasourceArchetype::InstantiateLayout(FUIDatasource* Datasource) const
+{
+	const FUIDatasourceArchetypeLayout& CompiledLayout = GetLayout();
+	FUIDatasourcePool* Pool = Datasource->GetPool();
+	TArray<FUIDatasource*, TInlineAllocator<64>> Instances;
+	Instances.SetNumUninitialized(CompiledLayout.Nodes.Num());
+	TArray<FUIDatasource*> Items;
+	for(int32 NodeIndex = 0; NodeIndex < CompiledLayout.Nodes.Num(); ++NodeIndex)
+	{
+		const FUIDatasourceArchetypeLayoutNode& Node = CompiledLayout.Nodes[NodeIndex];
+		FUIDatasource* Instance = Node.Parent == INDEX_NONE ? Datasource : Pool->FindOrCreateChildDatasource(Instances[Node.Parent], Node.Name);
+		Instances[NodeIndex] = Instance;
+
+		if(Node.bIsArray)
+		{
+			// Items are appended together, then each is built from the (already compiled) item archetype layout, room was checked up front
+			if(FUIArrayDatasource::Make(Instance)->AppendN(Node.InitialCount, &Items) && Node.ItemArchetype)
 			{
-			case EUIDatasourceValueType::Void: break;
-			case EUIDatasourceValueType::Int:
-				ChildDatasource->Set<int32>({});
-				break;
-			case EUIDatasourceValueType::Enum:
-				ChildDatasource->Set<int32>({});
-				break;
-			case EUIDatasourceValueType::Float:
-				ChildDatasource->Set<float>({});
-				break;
-			case EUIDatasourceValueType::Bool:
-				ChildDatasource->Set<bool>({});
-				break;
-			case EUIDatasourceValueType::Name:
-				ChildDatasource->Set<FName>({});
-				break;
-			case EUIDatasourceValueType::Text:
-				ChildDatasource->Set<FText>({});
-				break;
-			case EUIDatasourceValueType::String:
-				ChildDatasource->Set<FString>({});
-				break;
-			case EUIDatasourceValueType::Image:
-				ChildDatasource->Set<FUIDatasourceImage>({});
-				break;
-			case EUIDatasourceValueType::GameplayTag:
-				ChildDatasource->Set<FGameplayTag>({});
-				break;
-			case EUIDatasourceValueType::Struct:
-				ChildDatasource->Set<FInstancedStruct>({});
-				break;
-			case EUIDatasourceValueType::Archetype:
-				if(Descriptor.Archetype)
+				for(FUIDatasource* Item : Items)
 				{
-					switch(Descriptor.ImportMethod)
-					{
-					case EUIDatasourceArchetypeImportMethod::AsChild:
-						Descriptor.Archetype->GenerateDatasource(ChildDatasource);
-						break;
-					case EUIDatasourceArchetypeImportMethod::AsArray:
-						// @TODO: Build array datasource structure
-						break;
-					default: ;
-					}
+					Node.ItemArchetype->InstantiateLayout(Item);
 				}
-				break;
-			default: ;
 			}
 		}
+		else
+		{
+			if(Node.bHashStructValue)
+			{
+				EnumAddFlags(Instance->Flags, EUIDatasourceFlag::HashStructValues);
+			}
+			if(Node.ChangePolicy.Mode != EUIDatasourceChangePolicyMode::None)
+			{
+				Pool->SetChangePolicy(Instance, Node.ChangePolicy);
+			}
+			SetDefaultValue(Instance, Node.Type);
+		}
 	}
 }
 
@@ -177,7 +266,193 @@ const TArray<FUIDatasourceDescriptor>& UUIDatasourceArchetype::GetDescriptors()
 void UUIDatasourceArchetype::SetChildren(const TArray<FUIDatasourceDescriptor>& Descriptors)
 {
 	Children = Descriptors;
+#if WITH_EDITOR
+	EditEpoch++;
+#endif
+	CompileLayout(Layout);
+}
+
+bool UUIDatasourceArchetype::ImportsArchetype(const UUIDatasourceArchetype* Archetype) const
+{
+	TArray<const UUIDatasourceArchetype*, TInlineAllocator<16>> Visited = { this };
+	for(int32 Index = 0; Index < Visited.Num(); ++Index)
+	{
+		if(Visited[Index] == Archetype)
+		{
+			return true;
+		}
+
+		for(const FUIDatasourceDescriptor& Descriptor : Visited[Index]->Children)
+		{
+			if(Descriptor.Archetype && (Descriptor.IsInlineArchetype() || Descriptor.Type == EUIDatasourceValueType::Archetype))
+			{
+				Visited.AddUnique(Descriptor.Archetype);
+			}
+		}
+	}
+	return false;
+}
+
+const FUIDatasourceArchetypeLayout& UUIDatasourceArchetype::GetLayout() const
+{
+#if WITH_EDITOR
+	const bool bIsUpToDate = Layout.bIsCompiled && Layout.IsUpToDate();
+#else
+	const bool bIsUpToDate = Layout.bIsCompiled;
+#endif
+	if(!bIsUpToDate)
+	{
+		// Staging pools can be generated off the game thread, they must only ever see a layout compiled on load
+		checkf(IsInGameThread(), TEXT("Archetype %s layout is out of date outside of the game thread."), *GetPathName());
+		CompileLayout(Layout);
+	}
+	return Layout;
+}
+
+void UUIDatasourceArchetype::PostLoad()
+{
+	Super::PostLoad();
+
+	// Cooked archetypes come with their layout, compile the others now rather than on first use
+	if(!Layout.bIsCompiled)
+	{
+		CompileLayout(Layout);
+	}
+}
+
+void UUIDatasourceArchetype::CompileLayout(FUIDatasourceArchetypeLayout& OutLayout) const
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	OutLayout = {};
+	OutLayout.Nodes.AddDefaulted(); // Node 0 is the datasource we instantiate on
+	
+	TArray<const UUIDatasourceArchetype*> ArchetypeStack;
+	TMap<TPair<int32, FName>, int32> NodeLookup;
+	CompileLayout_Recursive(OutLayout, 0, ArchetypeStack, NodeLookup);
+	
+	OutLayout.bIsCompiled = true;
+}
+
+#if WITH_EDITOR
+bool FUIDatasourceArchetypeLayout::IsUpToDate() const
+{
+	for(const TPair<TWeakObjectPtr<const UUIDatasourceArchetype>, uint32>& Dependency : Dependencies)
+	{
+		const UUIDatasourceArchetype* Archetype = Dependency.Key.Get();
+		if(!Archetype || Archetype->GetEditEpoch() != Dependency.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+#endif
+
+void UUIDatasourceArchetype::CompileLayout_Recursive(FUIDatasourceArchetypeLayout& OutLayout, int32 ParentNode, TArray<const UUIDatasourceArchetype*>& ArchetypeStack, TMap<TPair<int32, FName>, int32>& NodeLookup) const
+{
+	if(ArchetypeStack.Contains(this))
+	{
+		UE_LOG(LogDatasource, Error, TEXT("Archetype %s imports itself, skipping recursive import."), *GetPathName());
+		return;
+	}
+	ArchetypeStack.Push(this);
+#if WITH_EDITOR
+	OutLayout.Dependencies.AddUnique({ this, EditEpoch });
+#endif
+
+	TArray<FString> PathSegments;
+	for(const FUIDatasourceDescriptor& Descriptor : Children)
+	{
+		if(Descriptor.IsInlineArchetype())
+		{
+			Descriptor.Archetype->CompileLayout_Recursive(OutLayout, ParentNode, ArchetypeStack, NodeLookup);
+			continue;
+		}
+
+		// Reuse nodes already emitted under the same parent so "Stats.Health" and "Stats.Mana" share the same "Stats" node
+		int32 CurrentNode = ParentNode;
+		Descriptor.Path.ParseIntoArray(PathSegments, TEXT("."));
+		for(const FString& Segment : PathSegments)
+		{
+			const FName SegmentName(Segment);
+			int32& NodeIndex = NodeLookup.FindOrAdd({ CurrentNode, SegmentName }, INDEX_NONE);
+			if(NodeIndex == INDEX_NONE)
+			{
+				FUIDatasourceArchetypeLayoutNode& NewNode = OutLayout.Nodes.AddDefaulted_GetRef();
+				NewNode.Name = SegmentName;
+				NewNode.Parent = CurrentNode;
+				NodeIndex = OutLayout.Nodes.Num() - 1;
+			}
+			CurrentNode = NodeIndex;
+		}
+
+		FUIDatasourceArchetypeLayoutNode& Node = OutLayout.Nodes[CurrentNode];
+		switch(Descriptor.Type)
+		{
+		case EUIDatasourceValueType::Archetype:
+			if(Descriptor.Archetype)
+			{
+				switch(Descriptor.ImportMethod)
+				{
+				case EUIDatasourceArchetypeImportMethod::AsChild:
+					Descriptor.Archetype->CompileLayout_Recursive(OutLayout, CurrentNode, ArchetypeStack, NodeLookup);
+					break;
+				case EUIDatasourceArchetypeImportMethod::AsArray:
+					// Items are generated from their own layout, a cycle through them wouldn't show up in ArchetypeStack
+					if(Descriptor.Archetype->ImportsArchetype(this))
+					{
+						UE_LOG(LogDatasource, Error, TEXT("Archetype %s imports itself, skipping recursive import."), *GetPathName());
+						break;
+					}
+					OutLayout.Nodes[CurrentNode].bIsArray = true;
+					OutLayout.Nodes[CurrentNode].ItemArchetype = Descriptor.Archetype;
+					OutLayout.Nodes[CurrentNode].InitialCount = Descriptor.InitialCount;
+					break;
+				default: ;
+				}
+			}
+			break;
+		case EUIDatasourceValueType::Enum:
+			Node.Type = Node.Type == EUIDatasourceValueType::Void ? EUIDatasourceValueType::Int : Node.Type;
+			break;
+		default:
+			// First typed descriptor wins, same as setting the value of an already typed datasource
+			Node.Type = Node.Type == EUIDatasourceValueType::Void ? Descriptor.Type : Node.Type;
+			Node.bHashStructValue |= Descriptor.Type == EUIDatasourceValueType::Struct && Descriptor.bHashStructValue;
+			if(Descriptor.Type == EUIDatasourceValueType::Float || Descriptor.Type == EUIDatasourceValueType::Double)
+			{
+				Node.ChangePolicy = Node.ChangePolicy.Mode == EUIDatasourceChangePolicyMode::None ? Descriptor.ChangePolicy : Node.ChangePolicy;
+			}
+			break;
+		}
+	}
+
+	ArchetypeStack.Pop();
+}
+
+#if WITH_EDITOR
+void UUIDatasourceArchetype::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	EditEpoch++;
+}
+
+void UUIDatasourceArchetype::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	// Ship the compiled layout in cooked data, editor assets don't keep it around so it can't go stale
+	if(SaveContext.IsCooking())
+	{
+		CompileLayout(Layout);
+	}
+	else
+	{
+		Layout = {};
+	}
 }
+#endif
 
 TArray<FString> UUIDatasourceArchetype::GetEnumChoices()
 {
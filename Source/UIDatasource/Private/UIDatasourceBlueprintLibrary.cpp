@@ -45,6 +45,56 @@ bool UUIDatasourceBlueprintLibrary::EqualEqual_DatasourceHandle(FUIDatasourceHan
 	return HandleA == HandleB;
 }
 
+void UUIDatasourceBlueprintLibrary::SetDatasourceRateLimit(FUIDatasourceHandle Handle, FUIDatasourceRateLimit RateLimit)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	UUIDatasourceSubsystem::Get()->Monitor.SetRateLimit(Handle, RateLimit);
+#endif
+}
+
+bool UUIDatasourceBlueprintLibrary::SetDatasourceExpression(FUIDatasourceHandle Handle, FString Expression)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	return UUIDatasourceSubsystem::Get()->Monitor.SetDerivedExpression(Handle.Get(), Expression);
+#else
+	return false;
+#endif
+}
+
+FUIDatasourceHandle UUIDatasourceBlueprintLibrary::CloneDatasource(FUIDatasourceHandle Source, FUIDatasourceHandle NewParent, FName NewName, EUIDatasourceCloneMode Mode)
+{
+	return UUIDatasourceSubsystem::Get()->Pool.CloneSubtree(Source.Get(), NewParent.Get(), NewName, Mode);
+}
+
+bool UUIDatasourceBlueprintLibrary::ReparentDatasource(FUIDatasourceHandle Handle, FUIDatasourceHandle NewParent, FName NewName)
+{
+	return UUIDatasourceSubsystem::Get()->Pool.Reparent(Handle.Get(), NewParent.Get(), NewName);
+}
+
+bool UUIDatasourceBlueprintLibrary::SetDatasourceAlias(FUIDatasourceHandle Alias, FUIDatasourceHandle Target)
+{
+	return UUIDatasourceSubsystem::Get()->Pool.SetAlias(Alias.Get(), Target.Get());
+}
+
+int64 UUIDatasourceBlueprintLibrary::GetDatasourceVersion()
+{
+	return static_cast<int64>(UUIDatasourceSubsystem::Get()->Pool.GetVersion());
+}
+
+bool UUIDatasourceBlueprintLibrary::HasDatasourceChangedSince(FUIDatasourceHandle Handle, int64 Version, bool bIncludeChildren)
+{
+	return UUIDatasourceSubsystem::Get()->Pool.HasChangedSince(Handle, static_cast<uint64>(Version), bIncludeChildren);
+}
+
+TArray<FUIDatasourceHandle> UUIDatasourceBlueprintLibrary::GetSubtreeChanges(const FUIDatasourceChangeEventArgs& EventArgs)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	return TArray<FUIDatasourceHandle>(UUIDatasourceSubsystem::Get()->Monitor.GetDirtyDescendants(EventArgs.Handle));
+#else
+	return {};
+#endif
+}
+
 FUIDatasourceHandle UUIDatasourceBlueprintLibrary::ArrayDatasource_MakeArray(FUIDatasourceHandle Handle)
 {
 	if(FUIDatasource* Datasource = Handle.Get())
@@ -158,9 +208,10 @@ FUIDatasourceHandle UUIDatasourceBlueprintLibrary::ArrayDatasource_AppendFront(F
 template<typename T>
 T GetDatasourceValue(FUIDatasourceHandle Handle)
 {
-	T ReturnValue = {};
+	T ReturnValue = UIDatasource_DefaultValue<T>();
 	if(FUIDatasource* Datasource = Handle.Get())
 	{
+		Datasource->Pull();
 		Datasource->TryGet(ReturnValue);
 	}
 	return ReturnValue;
@@ -185,7 +236,7 @@ bool UUIDatasourceBlueprintLibrary::Set##Name(FUIDatasourceHandle Handle, Type V
 {																			\
 	if(FUIDatasource* Datasource = Handle.Get())							\
 	{																		\
-		return Datasource->Set(Value);										\
+		return Datasource->Set<Type>(MoveTemp(Value));						\
 	}																		\
 	return false;															\
 }
@@ -193,16 +244,75 @@ bool UUIDatasourceBlueprintLibrary::Set##Name(FUIDatasourceHandle Handle, Type V
 IMPL_LIB_FUNC(int32,		Int);
 IMPL_LIB_FUNC(float,		Float);
 IMPL_LIB_FUNC(bool,			Bool);
-IMPL_LIB_FUNC(FString,		String);
 IMPL_LIB_FUNC(FName,		FName);
 IMPL_LIB_FUNC(FText,		Text);
 IMPL_LIB_FUNC(FUIDatasourceImage, Image)
 
 IMPL_LIB_FUNC(FGameplayTag, GameplayTag)
 IMPL_LIB_FUNC(FInstancedStruct, Struct)
+IMPL_LIB_FUNC(FVector2D,	Vector2D)
+IMPL_LIB_FUNC(FLinearColor,	LinearColor)
+IMPL_LIB_FUNC(int64,		Int64)
+IMPL_LIB_FUNC(double,		Double)
 
 #undef IMPL_LIB_FUNC
 
+bool UUIDatasourceBlueprintLibrary::GetStructField(FUIDatasourceHandle Handle, FName Field, int32& Value)
+{
+	checkNoEntry(); // Custom thunk
+	return false;
+}
+
+DEFINE_FUNCTION(UUIDatasourceBlueprintLibrary::execGetStructField)
+{
+	P_GET_STRUCT(FUIDatasourceHandle, Handle);
+	P_GET_PROPERTY(FNameProperty, Field);
+	
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	const FProperty* ValueProperty = Stack.MostRecentProperty;
+	void* ValuePtr = Stack.MostRecentPropertyAddress;
+	
+	P_FINISH;
+	
+	P_NATIVE_BEGIN;
+	bool bFound = false;
+	const FInstancedStruct Struct = GetDatasourceValue<FInstancedStruct>(Handle);
+	if(Struct.IsValid() && ValueProperty && ValuePtr)
+	{
+		const FUIDatasourceResolvedField Resolved = FUIDatasourceResolvedField::Resolve(Struct.GetScriptStruct(), Field);
+		if(Resolved.Property && Resolved.Property->SameType(ValueProperty))
+		{
+			Resolved.Property->CopyCompleteValue(ValuePtr, Struct.GetMemory() + Resolved.Offset);
+			bFound = true;
+		}
+	}
+	*static_cast<bool*>(RESULT_PARAM) = bFound;
+	P_NATIVE_END;
+}
+
+// Strings are special cased so BP works transparently with interned string values
+FString UUIDatasourceBlueprintLibrary::GetString(FUIDatasourceHandle Handle)
+{
+	FString ReturnValue = {};
+	if(FUIDatasource* Datasource = Handle.Get())
+	{
+		Datasource->Pull();
+		Datasource->TryGetString(ReturnValue);
+	}
+	return ReturnValue;
+}
+
+bool UUIDatasourceBlueprintLibrary::SetString(FUIDatasourceHandle Handle, FString Value)
+{
+	if(FUIDatasource* Datasource = Handle.Get())
+	{
+		return Datasource->SetString(MoveTemp(Value));
+	}
+	return false;
+}
+
 TSoftObjectPtr<UTexture2D> UUIDatasourceBlueprintLibrary::GetTexture(FUIDatasourceHandle Handle)
 {
 	return GetDatasourceValue<FUIDatasourceImage>(Handle).AsTexture();
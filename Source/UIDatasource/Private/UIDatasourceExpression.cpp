@@ -0,0 +1,207 @@
+﻿// Copyright Sharundaar. All Rights Reserved.
+
+#include "UIDatasourceExpression.h"
+
+#include "UIDatasourceMonitor.h"
+
+namespace UIDatasourceExpression
+{
+	// Recursive descent over Expr := Term (+|- Term)*, Term := Unary (*|/ Unary)*, Unary := -Unary | Primary, Primary := Number | Path | (Expr)
+	struct FParser
+	{
+		FStringView Source;
+		int32 Cursor = 0;
+		FUIDatasourceExpression& Expression;
+		FString Error;
+
+		static bool IsPathChar(TCHAR Char) { return FChar::IsAlnum(Char) || Char == TEXT('_') || Char == TEXT('.'); }
+
+		TCHAR Peek()
+		{
+			while(Cursor < Source.Len() && FChar::IsWhitespace(Source[Cursor]))
+			{
+				Cursor++;
+			}
+			return Cursor < Source.Len() ? Source[Cursor] : TEXT('\0');
+		}
+
+		void Emit(FUIDatasourceExpression::EOp Op)
+		{
+			Expression.Program.Add({ Op });
+		}
+
+		bool ParseExpr()
+		{
+			if(!ParseTerm())
+			{
+				return false;
+			}
+			for(TCHAR Char = Peek(); Char == TEXT('+') || Char == TEXT('-'); Char = Peek())
+			{
+				Cursor++;
+				if(!ParseTerm())
+				{
+					return false;
+				}
+				Emit(Char == TEXT('+') ? FUIDatasourceExpression::EOp::Add : FUIDatasourceExpression::EOp::Subtract);
+			}
+			return true;
+		}
+
+		bool ParseTerm()
+		{
+			if(!ParseUnary())
+			{
+				return false;
+			}
+			for(TCHAR Char = Peek(); Char == TEXT('*') || Char == TEXT('/'); Char = Peek())
+			{
+				Cursor++;
+				if(!ParseUnary())
+				{
+					return false;
+				}
+				Emit(Char == TEXT('*') ? FUIDatasourceExpression::EOp::Multiply : FUIDatasourceExpression::EOp::Divide);
+			}
+			return true;
+		}
+
+		bool ParseUnary()
+		{
+			if(Peek() == TEXT('-'))
+			{
+				Cursor++;
+				if(!ParseUnary())
+				{
+					return false;
+				}
+				Emit(FUIDatasourceExpression::EOp::Negate);
+				return true;
+			}
+			return ParsePrimary();
+		}
+
+		bool ParsePrimary()
+		{
+			const TCHAR Char = Peek();
+			if(Char == TEXT('('))
+			{
+				Cursor++;
+				if(!ParseExpr())
+				{
+					return false;
+				}
+				if(Peek() != TEXT(')'))
+				{
+					Error = FString::Printf(TEXT("Expected ')' at %d"), Cursor);
+					return false;
+				}
+				Cursor++;
+				return true;
+			}
+
+			const int32 Start = Cursor;
+			while(Cursor < Source.Len() && IsPathChar(Source[Cursor]))
+			{
+				Cursor++;
+			}
+			if(Cursor == Start)
+			{
+				Error = Char == TEXT('\0') ? TEXT("Unexpected end of expression") : FString::Printf(TEXT("Unexpected '%c' at %d"), Char, Cursor);
+				return false;
+			}
+
+			const bool bIsNumber = FChar::IsDigit(Source[Start]) || Source[Start] == TEXT('.');
+			const TCHAR Last = Source[Cursor - 1];
+			if(bIsNumber && (Last == TEXT('e') || Last == TEXT('E')) && Cursor + 1 < Source.Len() && (Source[Cursor] == TEXT('+') || Source[Cursor] == TEXT('-')) && FChar::IsDigit(Source[Cursor + 1]))
+			{
+				// Signed exponent (1e-3), the sign would otherwise end the token
+				Cursor++;
+				while(Cursor < Source.Len() && FChar::IsDigit(Source[Cursor]))
+				{
+					Cursor++;
+				}
+			}
+
+			const FStringView Token = Source.Mid(Start, Cursor - Start);
+			if(bIsNumber)
+			{
+				const FString Number(Token);
+				TCHAR* End = nullptr;
+				const double Value = FCString::Strtod(*Number, &End);
+				if(End != *Number + Number.Len())
+				{
+					Error = FString::Printf(TEXT("Invalid number '%s'"), *Number);
+					return false;
+				}
+				Expression.Program.Add({ FUIDatasourceExpression::EOp::Number, Value });
+				return true;
+			}
+
+			Expression.Program.Add({ FUIDatasourceExpression::EOp::Input, 0.0, Expression.Inputs.AddUnique(FString(Token)) });
+			return true;
+		}
+	};
+}
+
+TSharedPtr<const FUIDatasourceExpression> FUIDatasourceExpression::Compile(FStringView Expression, FString& OutError)
+{
+	TSharedPtr<FUIDatasourceExpression> Compiled = MakeShared<FUIDatasourceExpression>();
+	UIDatasourceExpression::FParser Parser = { Expression, 0, *Compiled };
+	if(!Parser.ParseExpr())
+	{
+		OutError = MoveTemp(Parser.Error);
+		return nullptr;
+	}
+	if(Parser.Peek() != TEXT('\0'))
+	{
+		OutError = FString::Printf(TEXT("Unexpected '%c' at %d"), Parser.Peek(), Parser.Cursor);
+		return nullptr;
+	}
+	return Compiled;
+}
+
+double FUIDatasourceExpression::Evaluate(FUIDatasourceDeriveContext& Context) const
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	// Every input is read up front, so dependencies don't depend on the values
+	TArray<double, TInlineAllocator<8>> InputValues;
+	InputValues.Reserve(Inputs.Num());
+	for(const FString& Input : Inputs)
+	{
+		InputValues.Add(Context.GetNumber(Input));
+	}
+
+	TArray<double, TInlineAllocator<16>> Stack;
+	for(const FInstruction& Instruction : Program)
+	{
+		switch(Instruction.Op)
+		{
+		case EOp::Number:
+			Stack.Push(Instruction.Number);
+			break;
+		case EOp::Input:
+			Stack.Push(InputValues[Instruction.Input]);
+			break;
+		case EOp::Negate:
+			Stack.Last() = -Stack.Last();
+			break;
+		default:
+			{
+				const double Rhs = Stack.Pop();
+				double& Lhs = Stack.Last();
+				switch(Instruction.Op)
+				{
+				case EOp::Add:		Lhs += Rhs; break;
+				case EOp::Subtract:	Lhs -= Rhs; break;
+				case EOp::Multiply:	Lhs *= Rhs; break;
+				case EOp::Divide:	Lhs = Rhs != 0.0 ? Lhs / Rhs : 0.0; break;
+				default: ;
+				}
+			}
+			break;
+		}
+	}
+	return Stack.IsEmpty() ? 0.0 : Stack.Last();
+}
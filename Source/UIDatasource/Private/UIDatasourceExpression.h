@@ -0,0 +1,39 @@
+﻿// Copyright Sharundaar. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FUIDatasourceDeriveContext;
+
+// Arithmetic expression over datasource paths (e.g. Health / MaxHealth) backing FUIDatasourceMonitor::SetDerivedExpression.
+// Paths are resolved from the parent of the derived datasource, compiled once to a postfix program evaluated on a small stack.
+struct FUIDatasourceExpression
+{
+	enum class EOp : uint8
+	{
+		Number,
+		Input,
+		Add,
+		Subtract,
+		Multiply,
+		Divide,
+		Negate,
+	};
+
+	struct FInstruction
+	{
+		EOp Op = EOp::Number;
+		double Number = 0.0;
+		int32 Input = INDEX_NONE;
+	};
+
+	TArray<FInstruction> Program;
+	TArray<FString> Inputs;
+
+	// Returns nullptr and fills OutError if Expression isn't valid
+	static TSharedPtr<const FUIDatasourceExpression> Compile(FStringView Expression, FString& OutError);
+
+	// Division by zero yields 0, which is what a ratio bar wants when its max isn't set yet
+	double Evaluate(FUIDatasourceDeriveContext& Context) const;
+};
@@ -2,6 +2,9 @@
 
 #include "UIDatasourceModule.h"
 #include "UIDatasource.h"
+#include "UIDatasourceStructMapping.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
 
 DEFINE_LOG_CATEGORY(LogDatasource);
 UE_TRACE_CHANNEL_DEFINE(UIDatasourceTraceChannel);
@@ -10,10 +13,27 @@ UE_TRACE_CHANNEL_DEFINE(UIDatasourceTraceChannel);
 
 void FUIDatasourceModule::StartupModule()
 {
+	// Struct mappings hold raw properties, reinstanced or reloaded types leave them dangling
+	FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FUIDatasourceModule::OnObjectsReplaced);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FUIDatasourceModule::OnReloadComplete);
+	FCoreDelegates::OnEndFrame.AddStatic(&FUIDatasourceStructMapping::ReleaseInvalidated);
 }
 
 void FUIDatasourceModule::ShutdownModule()
 {
+	FCoreUObjectDelegates::OnObjectsReplaced.RemoveAll(this);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.RemoveAll(this);
+	FCoreDelegates::OnEndFrame.RemoveStatic(&FUIDatasourceStructMapping::ReleaseInvalidated);
+}
+
+void FUIDatasourceModule::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+	FUIDatasourceStructMapping::Invalidate();
+}
+
+void FUIDatasourceModule::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	FUIDatasourceStructMapping::Invalidate();
 }
 
 #undef LOCTEXT_NAMESPACE
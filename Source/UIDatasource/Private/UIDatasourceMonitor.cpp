@@ -1,72 +1,1242 @@
 ﻿#include "UIDatasourceMonitor.h"
 
+#include "UIDatasourceExpression.h"
+#include "UIDatasourceSubsystem.h"
+
 namespace FUIDatasourceMonitor_Local
 {
-	static TAutoConsoleVariable<bool> CVarProcessEventsImmediate(
-	TEXT("UIDatasource.Monitor.ProcessEventsImmediate"),
-	false,
-	TEXT("If enabled, process all queued events immediately instead of waiting for tick update."),
-	ECVF_Cheat);
+	static TAutoConsoleVariable<bool> CVarProcessEventsImmediate(
+	TEXT("UIDatasource.Monitor.ProcessEventsImmediate"),
+	false,
+	TEXT("If enabled, process all queued events immediately instead of waiting for tick update."),
+	ECVF_Cheat);
+
+}
+
+void FUIDatasourceMonitor::QueueDatasourceEvent(FUIDatasourceChangeEventArgs Event)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	MarkDependentsDirty(Event.Handle);
+	if(DeferRateLimitedEvent(Event))
+	{
+		return;
+	}
+	EnqueueEvent(Event);
+}
+
+void FUIDatasourceMonitor::EnqueueEvent(const FUIDatasourceChangeEventArgs& Event)
+{
+	if(!FUIDatasourceMonitor_Local::CVarProcessEventsImmediate.GetValueOnAnyThread())
+	{
+		bool bAlreadyQueued = false;
+		QueuedEventSet.Add(Event, &bAlreadyQueued);
+		if (!bAlreadyQueued)
+		{
+			QueuedEvents.Add(Event);
+		}
+	}
+	else
+	{
+		BroadcastEvent(Event);
+		if(!SubtreeHandlers.IsEmpty() && Event.Kind != EUIDatasourceChangeEventKind::Attached)
+		{
+			SubtreeEpoch = SubtreeEpoch + 1 != 0 ? SubtreeEpoch + 1 : 1;
+			MarkSubtreeDirty(Event.Handle.Get());
+			BroadcastSubtreeEvents();
+		}
+	}
+}
+
+void FUIDatasourceMonitor::BroadcastEvent(const FUIDatasourceChangeEventArgs& Event)
+{
+	if(!PatternRoots.IsEmpty() && Event.Kind != EUIDatasourceChangeEventKind::FieldSet)
+	{
+		if(const FUIDatasource* Datasource = Event.Handle.Get())
+		{
+			TArray<int32, TInlineAllocator<8>> MatchedNodes;
+			GatherPatternSubscriptions(Datasource, MatchedNodes);
+			for(const int32 NodeIndex : MatchedNodes)
+			{
+				FOnDatasourceChangedDelegate TmpDelegates = PatternNodes[NodeIndex].Delegates;
+				TmpDelegates.Broadcast(Event);
+			}
+		}
+	}
+
+	if(Event.Kind == EUIDatasourceChangeEventKind::Attached)
+	{
+		return; // Only meaningful to pattern subscriptions
+	}
+	
+	if(Event.Kind != EUIDatasourceChangeEventKind::FieldSet)
+	{
+		if(const FOnDatasourceChangedNative* NativeDelegates = NativeEventHandlers.Find(Event.Handle))
+		{
+			// Same as below, handlers may bind new datasources and reallocate the map while we broadcast
+			FOnDatasourceChangedNative TmpNativeDelegates = *NativeDelegates;
+			TmpNativeDelegates.Broadcast(Event);
+		}
+	}
+	
+	if(const FOnDatasourceChangedDelegate* Delegates = FindEventHandlers(Event))
+	{
+		// @TODO: Evaluate performance impact of this copy here, broadcasting this event might
+		// trigger some widgets to bind to some new datasources, this would potentially change EventHandlers size
+		// which means reallocating the underlying delegates, which we hold a pointer to in this scope
+		// making a local copy before broadcasting ensures we keep it valid.
+		FOnDatasourceChangedDelegate TmpDelegates = *Delegates;
+		TmpDelegates.Broadcast(Event);
+	}
+}
+
+void FUIDatasourceMonitor::QueueDatasourceEvents(TConstArrayView<FUIDatasourceChangeEventArgs> Events)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	if(FUIDatasourceMonitor_Local::CVarProcessEventsImmediate.GetValueOnAnyThread())
+	{
+		for(const FUIDatasourceChangeEventArgs& Event : Events)
+		{
+			QueueDatasourceEvent(Event);
+		}
+		return;
+	}
+
+	QueuedEventSet.Reserve(QueuedEventSet.Num() + Events.Num());
+	QueuedEvents.Reserve(QueuedEvents.Num() + Events.Num());
+	for(const FUIDatasourceChangeEventArgs& Event : Events)
+	{
+		MarkDependentsDirty(Event.Handle);
+		if(DeferRateLimitedEvent(Event))
+		{
+			continue;
+		}
+		
+		bool bAlreadyQueued = false;
+		QueuedEventSet.Add(Event, &bAlreadyQueued);
+		if (!bAlreadyQueued)
+		{
+			QueuedEvents.Add(Event);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::SetRateLimit(FUIDatasourceHandle Handle, const FUIDatasourceRateLimit& RateLimit)
+{
+	if(RateLimit.Mode == EUIDatasourceRateLimitMode::None)
+	{
+		FUIDatasourceRateLimitState State;
+		if(RateLimits.RemoveAndCopyValue(Handle, State) && State.bPending)
+		{
+			PendingRateLimitedCount--;
+			EnqueueEvent({ EUIDatasourceChangeEventKind::ValueSet, Handle });
+		}
+		return;
+	}
+
+	RateLimits.FindOrAdd(Handle).Settings = RateLimit;
+}
+
+bool FUIDatasourceMonitor::DeferRateLimitedEvent(const FUIDatasourceChangeEventArgs& Event)
+{
+	if(RateLimits.IsEmpty() || Event.Kind != EUIDatasourceChangeEventKind::ValueSet)
+	{
+		return false;
+	}
+
+	FUIDatasourceRateLimitState* State = RateLimits.Find(Event.Handle);
+	if(!State)
+	{
+		return false;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	State->LastChangeTime = Now;
+	if(State->Settings.Mode == EUIDatasourceRateLimitMode::Throttle && !State->bPending && Now - State->LastDeliveryTime >= 1.0 / FMath::Max(State->Settings.MaxEventsPerSecond, UE_KINDA_SMALL_NUMBER))
+	{
+		State->LastDeliveryTime = Now; // Leading edge, nothing delivered recently
+		return false;
+	}
+
+	if(State->bPending)
+	{
+		State->SuppressedCount++;
+		SuppressedEventCount++;
+	}
+	else
+	{
+		State->bPending = true;
+		State->FirstPendingTime = Now;
+		PendingRateLimitedCount++;
+	}
+	return true;
+}
+
+void FUIDatasourceMonitor::FlushRateLimitedEvents()
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	if(PendingRateLimitedCount <= 0)
+	{
+		return;
+	}
+	
+	const double Now = FPlatformTime::Seconds();
+	for(auto It = RateLimits.CreateIterator(); It; ++It)
+	{
+		FUIDatasourceRateLimitState& State = It->Value;
+		if(!State.bPending)
+		{
+			continue;
+		}
+
+		if(!It->Key.Get())
+		{
+			PendingRateLimitedCount--;
+			It.RemoveCurrent(); // Datasource got destroyed while its event was pending
+			continue;
+		}
+
+		const FUIDatasourceRateLimit& Settings = State.Settings;
+		const bool bIsDue = Settings.Mode == EUIDatasourceRateLimitMode::Throttle
+			? Now - State.LastDeliveryTime >= 1.0 / FMath::Max(Settings.MaxEventsPerSecond, UE_KINDA_SMALL_NUMBER)
+			: Now - State.LastChangeTime >= Settings.DebounceDelay || (Settings.MaxDebounceDelay > 0.0f && Now - State.FirstPendingTime >= Settings.MaxDebounceDelay);
+		if(bIsDue)
+		{
+			State.bPending = false;
+			State.LastDeliveryTime = Now;
+			PendingRateLimitedCount--;
+			EnqueueEvent({ EUIDatasourceChangeEventKind::ValueSet, It->Key });
+		}
+	}
+}
+
+FUIDatasource* FUIDatasourceDeriveContext::Find(FStringView Path)
+{
+	// Reading must not create anything, an evaluation would otherwise grow the tree from a typo in an expression
+	FUIDatasourcePool* Pool = Target.GetPool();
+	FUIDatasource* Source = Pool->FindDatasource(Pool->GetDatasourceById(Target.Parent), Path);
+	bReadMissingInput |= !Source;
+	return Source;
+}
+
+double FUIDatasourceDeriveContext::GetNumber(FUIDatasource* Source)
+{
+	if(!Source)
+	{
+		return 0.0;
+	}
+
+	Dependencies.AddUnique(Source);
+	Source->Pull();
+	const FUIDatasourceValue::FValueType& Value = Source->Value.Value;
+	if(const int32* Int = Value.TryGet<int32>())		return *Int;
+	if(const float* Float = Value.TryGet<float>())		return *Float;
+	if(const double* Double = Value.TryGet<double>())	return *Double;
+	if(const int64* Int64 = Value.TryGet<int64>())		return static_cast<double>(*Int64);
+	if(const bool* Bool = Value.TryGet<bool>())			return *Bool ? 1.0 : 0.0;
+	return 0.0;
+}
+
+void FUIDatasourceMonitor::SetDerived(FUIDatasource* Target, FUIDatasourceDeriveFunc Func)
+{
+	if(!Target || EnumHasAllFlags(Target->Flags, EUIDatasourceFlag::IsSink) || !Func)
+	{
+		return;
+	}
+
+	const FUIDatasourceHandle Handle(Target);
+	ClearDerived(Handle);
+	Derivations.Add(Handle).Func = MakeShared<const FUIDatasourceDeriveFunc>(MoveTemp(Func));
+	DirtyDerivations.Add(Handle);
+}
+
+bool FUIDatasourceMonitor::SetDerivedExpression(FUIDatasource* Target, FStringView Expression)
+{
+	FString Error;
+	TSharedPtr<const FUIDatasourceExpression> Compiled = FUIDatasourceExpression::Compile(Expression, Error);
+	if(!Compiled)
+	{
+		UE_LOG(LogDatasource, Error, TEXT("Invalid derived datasource expression '%.*s': %s"), Expression.Len(), Expression.GetData(), *Error);
+		return false;
+	}
+
+	SetDerived(Target, [Compiled = Compiled.ToSharedRef()](FUIDatasourceDeriveContext& Context)
+	{
+		const double Result = Compiled->Evaluate(Context);
+		if(Context.Target.Value.Value.IsType<double>())
+		{
+			Context.Target.Set<double>(Result);
+		}
+		else
+		{
+			Context.Target.Set<float>(static_cast<float>(Result));
+		}
+	});
+	return true;
+}
+
+void FUIDatasourceMonitor::ClearDerived(FUIDatasourceHandle Handle)
+{
+	if(FUIDatasourceDerivation* Derivation = Derivations.Find(Handle))
+	{
+		UpdateDependencies(Handle, *Derivation, {});
+		Derivations.Remove(Handle);
+		WaitingDerivations.RemoveSingleSwap(Handle);
+	}
+}
+
+void FUIDatasourceMonitor::SetProvider(FUIDatasource* Datasource, FUIDatasourceProvideFunc Provide, FUIDatasourceObservedFunc OnObservedChanged)
+{
+	if(!ensure(Datasource) || EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return;
+	}
+
+	FUIDatasourceProvider& Provider = Providers.FindOrAdd(Datasource);
+	Provider.Provide = MoveTemp(Provide);
+	Provider.OnObservedChanged = MoveTemp(OnObservedChanged);
+	Provider.bStale = true;
+	EnumAddFlags(Datasource->Flags, EUIDatasourceFlag::IsProvider);
+
+	if(Datasource->IsObserved())
+	{
+		if(Provider.OnObservedChanged)
+		{
+			Provider.OnObservedChanged(Datasource, true);
+		}
+		PullProvider(Datasource);
+	}
+}
+
+void FUIDatasourceMonitor::ClearProvider(FUIDatasourceHandle Handle)
+{
+	if(Providers.Remove(Handle) > 0)
+	{
+		StaleProviders.Remove(Handle);
+		if(FUIDatasource* Datasource = Handle.Get())
+		{
+			EnumRemoveFlags(Datasource->Flags, EUIDatasourceFlag::IsProvider);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::InvalidateProvider(FUIDatasourceHandle Handle)
+{
+	FUIDatasourceProvider* Provider = Providers.Find(Handle);
+	if(!Provider || Provider->bStale)
+	{
+		return;
+	}
+
+	// Unobserved providers only compute again when read, derived datasources reading it are such readers
+	Provider->bStale = true;
+	const FUIDatasource* Datasource = Handle.Get();
+	if(Datasource && Datasource->IsObserved())
+	{
+		StaleProviders.Add(Handle);
+	}
+	else
+	{
+		MarkDependentsDirty(Handle);
+	}
+}
+
+void FUIDatasourceMonitor::PullProvider(FUIDatasource* Datasource)
+{
+	FUIDatasourceProvider* Provider = Providers.Find(Datasource);
+	if(!Provider || !Provider->bStale)
+	{
+		return;
+	}
+
+	UIDATASOURCE_FUNC_TRACE()
+	
+	Provider->bStale = false; // Before calling out, the provider may read itself
+	const FUIDatasourceProvideFunc Provide = Provider->Provide; // Provide may register new providers and reallocate the map
+	Provide(*Datasource);
+}
+
+void FUIDatasourceMonitor::EvaluateProviders()
+{
+	if(StaleProviders.IsEmpty())
+	{
+		return;
+	}
+	
+	UIDATASOURCE_FUNC_TRACE()
+	
+	TArray<FUIDatasourceHandle> ToEvaluate = MoveTemp(StaleProviders);
+	StaleProviders.Reset();
+	for(const FUIDatasourceHandle& Handle : ToEvaluate)
+	{
+		if(FUIDatasource* Datasource = Handle.Get())
+		{
+			PullProvider(Datasource);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::AddObserver(FUIDatasourceHandle Handle)
+{
+	FUIDatasource* Datasource = Handle.Get();
+	if(!Datasource)
+	{
+		return;
+	}
+	
+	UpdateObserverCounts(Datasource, 1);
+	if(Datasource->ObserverCount != 1)
+	{
+		return;
+	}
+
+	if(const FUIDatasourceProvider* Provider = Providers.Find(Handle))
+	{
+		if(Provider->OnObservedChanged)
+		{
+			const FUIDatasourceObservedFunc OnObservedChanged = Provider->OnObservedChanged;
+			OnObservedChanged(Datasource, true);
+		}
+		PullProvider(Datasource);
+	}
+}
+
+void FUIDatasourceMonitor::RemoveObserver(FUIDatasourceHandle Handle)
+{
+	FUIDatasource* Datasource = Handle.Get();
+	if(!Datasource || !ensure(Datasource->ObserverCount > 0))
+	{
+		return; // Destroyed datasources already released their observers
+	}
+	
+	UpdateObserverCounts(Datasource, -1);
+	if(Datasource->ObserverCount != 0)
+	{
+		return;
+	}
+	
+	if(const FUIDatasourceProvider* Provider = Providers.Find(Handle))
+	{
+		if(Provider->OnObservedChanged)
+		{
+			const FUIDatasourceObservedFunc OnObservedChanged = Provider->OnObservedChanged;
+			OnObservedChanged(Datasource, false);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::PurgeDatasources(TConstArrayView<FUIDatasourceHandle> Handles, TArray<FUIDatasourceDeferredObservedChange>& OutDeferred)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	// Observed datasources lose their observers with them, their providers and ObservedChanged listeners are told like releasing them
+	// one by one would, so whatever they started upstream (polling, subscriptions...) gets stopped
+	for(const FUIDatasourceHandle& Handle : Handles)
+	{
+		const FUIDatasource* Datasource = Handle.Get();
+		if(!Datasource)
+		{
+			continue;
+		}
+
+		const FUIDatasourceProvider* Provider = Datasource->ObserverCount > 0 ? Providers.Find(Handle) : nullptr;
+		const FOnDatasourceObservedChanged* Handlers = Datasource->SubtreeObserverCount > 0 ? ObservedChangedHandlers.Find(Handle) : nullptr;
+		if((Provider && Provider->OnObservedChanged) || Handlers)
+		{
+			FUIDatasourceDeferredObservedChange& Change = OutDeferred.AddDefaulted_GetRef();
+			Change.Handle = Handle;
+			Change.OnObservedChanged = Provider ? Provider->OnObservedChanged : FUIDatasourceObservedFunc();
+			Change.Handlers = Handlers ? *Handlers : FOnDatasourceObservedChanged();
+		}
+	}
+	
+	for(const FUIDatasourceHandle& Handle : Handles)
+	{
+		// Derivations reading it see it missing on their next evaluation
+		MarkDependentsDirty(Handle);
+		DerivedDependents.Remove(Handle);
+		EventHandlers.Remove(Handle);
+		NativeEventHandlers.Remove(Handle);
+		FieldHandlers.Remove(Handle);
+		SubtreeHandlers.Remove(Handle);
+		DirtySubtrees.Remove(Handle);
+		ObservedChangedHandlers.Remove(Handle);
+		if(PatternRoots.Contains(Handle))
+		{
+			// Its trie is freed by the next sweep rather than under a pattern broadcast, its stale handle can't match anything meanwhile
+			bCleanupDelegates = true;
+		}
+		if(const FUIDatasourceRateLimitState* State = RateLimits.Find(Handle))
+		{
+			PendingRateLimitedCount -= State->bPending ? 1 : 0;
+			RateLimits.Remove(Handle);
+		}
+		if(Providers.Remove(Handle) > 0)
+		{
+			StaleProviders.Remove(Handle);
+		}
+		ClearDerived(Handle);
+	}
+}
+
+void FUIDatasourceMonitor::UpdateObserverCounts(FUIDatasource* Datasource, int32 Delta)
+{
+	Datasource->ObserverCount += Delta;
+	UpdateSubtreeObserverCounts(Datasource, Delta);
+}
+
+void FUIDatasourceMonitor::UpdateSubtreeObserverCounts(FUIDatasource* From, int32 Delta, TArray<FUIDatasourceDeferredObservedChange>* OutDeferred)
+{
+	if(Delta == 0 || !From)
+	{
+		return;
+	}
+
+	// Only subtree transitions from or to zero are worth telling anyone about
+	TArray<FUIDatasourceHandle, TInlineAllocator<8>> Transitioned;
+	FUIDatasourcePool* Pool = From->GetPool();
+	for(FUIDatasource* Node = From; Node; Node = Pool->GetDatasourceById(Node->Parent))
+	{
+		const bool bWasObserved = Node->SubtreeObserverCount > 0;
+		Node->SubtreeObserverCount += Delta;
+		if(bWasObserved != (Node->SubtreeObserverCount > 0) && ObservedChangedHandlers.Contains(Node))
+		{
+			Transitioned.Add(Node);
+		}
+	}
+
+	for(const FUIDatasourceHandle& Handle : Transitioned)
+	{
+		if(const FOnDatasourceObservedChanged* Handlers = ObservedChangedHandlers.Find(Handle))
+		{
+			if(OutDeferred)
+			{
+				FUIDatasourceDeferredObservedChange& Change = OutDeferred->AddDefaulted_GetRef();
+				Change.Handle = Handle;
+				Change.Handlers = *Handlers;
+				Change.bObserved = Delta > 0;
+				continue;
+			}
+			const FOnDatasourceObservedChanged TmpHandlers = *Handlers;
+			TmpHandlers.Broadcast(Handle, Delta > 0);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::NotifyObservedChanged(TConstArrayView<FUIDatasourceDeferredObservedChange> Changes)
+{
+	for(const FUIDatasourceDeferredObservedChange& Change : Changes)
+	{
+		if(Change.OnObservedChanged)
+		{
+			Change.OnObservedChanged(Change.Handle, Change.bObserved);
+		}
+		Change.Handlers.Broadcast(Change.Handle, Change.bObserved);
+	}
+}
+
+FDelegateHandle FUIDatasourceMonitor::BindObservedChanged(FUIDatasourceHandle Handle, const FOnDatasourceObservedChanged::FDelegate& Delegate)
+{
+	return ObservedChangedHandlers.FindOrAdd(Handle).Add(Delegate);
+}
+
+void FUIDatasourceMonitor::UnbindObservedChanged(FUIDatasourceHandle Handle, FDelegateHandle DelegateHandle)
+{
+	if(FOnDatasourceObservedChanged* Handlers = ObservedChangedHandlers.Find(Handle))
+	{
+		Handlers->Remove(DelegateHandle);
+		if(!Handlers->IsBound())
+		{
+			ObservedChangedHandlers.Remove(Handle);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::MarkDependentsDirty(FUIDatasourceHandle Input)
+{
+	if(DerivedDependents.IsEmpty())
+	{
+		return;
+	}
+	
+	if(const TArray<FUIDatasourceHandle>* Dependents = DerivedDependents.Find(Input))
+	{
+		for(const FUIDatasourceHandle& Dependent : *Dependents)
+		{
+			FUIDatasourceDerivation* Derivation = Derivations.Find(Dependent);
+			if(Derivation && !Derivation->bDirty)
+			{
+				Derivation->bDirty = true;
+				DirtyDerivations.Add(Dependent);
+			}
+		}
+	}
+}
+
+void FUIDatasourceMonitor::EvaluateDerivations()
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	// Missing inputs don't notify anything once created, poll the derivations waiting on one
+	for(const FUIDatasourceHandle& Handle : WaitingDerivations)
+	{
+		FUIDatasourceDerivation* Derivation = Derivations.Find(Handle);
+		if(Derivation && !Derivation->bDirty)
+		{
+			Derivation->bDirty = true;
+			DirtyDerivations.Add(Handle);
+		}
+	}
+	WaitingDerivations.Reset();
+	
+	// Evaluations write their target which may dirty other derivations, they get appended and evaluated in this same pass
+	TArray<FUIDatasourceHandle, TInlineAllocator<8>> Stack;
+	for(int32 Index = 0; Index < DirtyDerivations.Num(); ++Index)
+	{
+		const FUIDatasourceHandle Handle = DirtyDerivations[Index];
+		EvaluateDerivation(Handle, Stack);
+	}
+	DirtyDerivations.Reset();
+}
+
+void FUIDatasourceMonitor::EvaluateDerivation(FUIDatasourceHandle Handle, TArray<FUIDatasourceHandle, TInlineAllocator<8>>& Stack)
+{
+	FUIDatasourceDerivation* Derivation = Derivations.Find(Handle);
+	if(!Derivation || !Derivation->bDirty || Derivation->bIsCyclic || Stack.Contains(Handle))
+	{
+		return;
+	}
+
+	FUIDatasource* Target = Handle.Get();
+	if(!Target)
+	{
+		ClearDerived(Handle); // Derived datasource got destroyed
+		return;
+	}
+
+	// Inputs that are dirty derived datasources themselves go first, so we're computed once and from up to date values
+	Stack.Push(Handle);
+	const TArray<FUIDatasourceHandle, TInlineAllocator<4>> Inputs = Derivation->Dependencies;
+	for(const FUIDatasourceHandle& Input : Inputs)
+	{
+		EvaluateDerivation(Input, Stack);
+	}
+	Stack.Pop();
+
+	Derivation = Derivations.Find(Handle);
+	if(!Derivation)
+	{
+		return;
+	}
+	
+	Derivation->bDirty = false;
+	FUIDatasourceDeriveContext Context(*Target);
+	const TSharedPtr<const FUIDatasourceDeriveFunc> Func = Derivation->Func; // The functor may clear or replace derivations, this one included
+	(*Func)(Context);
+
+	Derivation = Derivations.Find(Handle);
+	if(!Derivation)
+	{
+		return;
+	}
+	UpdateDependencies(Handle, *Derivation, Context.Dependencies);
+	if(Context.bReadMissingInput)
+	{
+		WaitingDerivations.AddUnique(Handle);
+	}
+	
+	if(DependsOn(Handle, Handle))
+	{
+		FString Path;
+		Target->GetPath(Path);
+		UE_LOG(LogDatasource, Error, TEXT("Derived datasource %s depends on itself, it won't be updated anymore."), *Path);
+		Derivation->bIsCyclic = true;
+	}
+}
+
+void FUIDatasourceMonitor::UpdateDependencies(FUIDatasourceHandle Handle, FUIDatasourceDerivation& Derivation, TConstArrayView<FUIDatasourceHandle> Dependencies)
+{
+	for(const FUIDatasourceHandle& Previous : Derivation.Dependencies)
+	{
+		if(!Dependencies.Contains(Previous))
+		{
+			TArray<FUIDatasourceHandle>* Dependents = DerivedDependents.Find(Previous);
+			if(Dependents && Dependents->RemoveSingleSwap(Handle) && Dependents->IsEmpty())
+			{
+				DerivedDependents.Remove(Previous);
+			}
+		}
+	}
+	
+	for(const FUIDatasourceHandle& Dependency : Dependencies)
+	{
+		if(!Derivation.Dependencies.Contains(Dependency))
+		{
+			DerivedDependents.FindOrAdd(Dependency).AddUnique(Handle);
+		}
+	}
+	Derivation.Dependencies.Reset();
+	Derivation.Dependencies.Append(Dependencies.GetData(), Dependencies.Num());
+}
+
+bool FUIDatasourceMonitor::DependsOn(FUIDatasourceHandle Derived, FUIDatasourceHandle Input) const
+{
+	TArray<FUIDatasourceHandle, TInlineAllocator<16>> Pending = { Derived };
+	TSet<FUIDatasourceHandle> Visited;
+	while(!Pending.IsEmpty())
+	{
+		const FUIDatasourceDerivation* Derivation = Derivations.Find(Pending.Pop());
+		if(!Derivation)
+		{
+			continue;
+		}
+		
+		for(const FUIDatasourceHandle& Dependency : Derivation->Dependencies)
+		{
+			if(Dependency == Input)
+			{
+				return true;
+			}
+
+			bool bAlreadyVisited = false;
+			Visited.Add(Dependency, &bAlreadyVisited);
+			if(!bAlreadyVisited)
+			{
+				Pending.Push(Dependency);
+			}
+		}
+	}
+	return false;
+}
+
+const FOnDatasourceChangedDelegate* FUIDatasourceMonitor::FindEventHandlers(const FUIDatasourceChangeEventArgs& Event) const
+{
+	if(Event.Kind == EUIDatasourceChangeEventKind::FieldSet)
+	{
+		const TMap<FName, FOnDatasourceChangedDelegate>* Fields = FieldHandlers.Find(Event.Handle);
+		return Fields ? Fields->Find(Event.Field) : nullptr;
+	}
+	return EventHandlers.Find(Event.Handle);
+}
+
+void FUIDatasourceMonitor::BindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	FOnDatasourceChangedDelegate& Delegates = EventHandlers.FindOrAdd(Handle);
+	if(!Delegates.Contains(Delegate))
+	{
+		Delegates.Add(Delegate);
+		AddObserver(Handle);
+	}
+}
+
+void FUIDatasourceMonitor::UnbindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	if (FOnDatasourceChangedDelegate* Delegates = EventHandlers.Find(Handle); Delegates && Delegates->Contains(Delegate))
+	{
+		Delegates->Remove(Delegate);
+		RemoveObserver(Handle);
+		if (!Delegates->IsBound())
+		{
+			bCleanupDelegates = true;
+		}
+	}
+}
+
+void FUIDatasourceMonitor::BindDatasourceNativeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedNative::FDelegate& Delegate)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	NativeEventHandlers.FindOrAdd(Handle).Add(Delegate);
+	AddObserver(Handle);
+}
+
+void FUIDatasourceMonitor::UnbindDatasourceNativeEvent(FUIDatasourceHandle Handle, FDelegateHandle DelegateHandle)
+{
+	if (FOnDatasourceChangedNative* Delegates = NativeEventHandlers.Find(Handle))
+	{
+		if(Delegates->Remove(DelegateHandle))
+		{
+			RemoveObserver(Handle);
+		}
+		if (!Delegates->IsBound())
+		{
+			bCleanupDelegates = true;
+		}
+	}
+}
 
+void FUIDatasourceMonitor::BindDatasourceSubtreeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	FOnDatasourceChangedDelegate& Delegates = SubtreeHandlers.FindOrAdd(Handle);
+	if(!Delegates.Contains(Delegate))
+	{
+		Delegates.Add(Delegate);
+		AddObserver(Handle);
+	}
 }
 
-void FUIDatasourceMonitor::QueueDatasourceEvent(FUIDatasourceChangeEventArgs Event)
+void FUIDatasourceMonitor::UnbindDatasourceSubtreeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	if (FOnDatasourceChangedDelegate* Delegates = SubtreeHandlers.Find(Handle); Delegates && Delegates->Contains(Delegate))
+	{
+		Delegates->Remove(Delegate);
+		RemoveObserver(Handle);
+		if(!Delegates->IsBound())
+		{
+			bCleanupDelegates = true;
+		}
+	}
+}
+
+TConstArrayView<FUIDatasourceHandle> FUIDatasourceMonitor::GetDirtyDescendants(FUIDatasourceHandle Handle) const
+{
+	const TArray<FUIDatasourceHandle>* Descendants = DirtySubtrees.Find(Handle);
+	return Descendants ? TConstArrayView<FUIDatasourceHandle>(*Descendants) : TConstArrayView<FUIDatasourceHandle>();
+}
+
+void FUIDatasourceMonitor::MarkSubtreeDirty(FUIDatasource* Datasource)
+{
+	if(!Datasource)
+	{
+		return;
+	}
+
+	if(SubtreeHandlers.Contains(Datasource))
+	{
+		DirtySubtrees.FindOrAdd(Datasource).AddUnique(Datasource);
+	}
+
+	// Each subscribed ancestor records the child the change came through, a child already marked
+	// this flush has been recorded along with all of its ancestors so we can stop there
+	FUIDatasourcePool* Pool = Datasource->GetPool();
+	for(FUIDatasource* Node = Datasource; Node && Node->SubtreeEpoch != SubtreeEpoch; )
+	{
+		Node->SubtreeEpoch = SubtreeEpoch;
+		FUIDatasource* Parent = Pool->GetDatasourceById(Node->Parent);
+		if(Parent && SubtreeHandlers.Contains(Parent))
+		{
+			DirtySubtrees.FindOrAdd(Parent).Add(Node);
+		}
+		Node = Parent;
+	}
+}
+
+void FUIDatasourceMonitor::BroadcastSubtreeEvents()
 {
 	UIDATASOURCE_FUNC_TRACE()
+	
+	// Handlers may bind new subtrees while we broadcast, iterate over a copy of the keys
+	TArray<FUIDatasourceHandle, TInlineAllocator<16>> Subtrees;
+	DirtySubtrees.GetKeys(Subtrees);
+	for(const FUIDatasourceHandle Subtree : Subtrees)
+	{
+		if(const FOnDatasourceChangedDelegate* Delegates = SubtreeHandlers.Find(Subtree))
+		{
+			FOnDatasourceChangedDelegate TmpDelegates = *Delegates;
+			TmpDelegates.Broadcast({ EUIDatasourceChangeEventKind::SubtreeChanged, Subtree });
+		}
+	}
+	DirtySubtrees.Reset();
+}
 
-	if(!FUIDatasourceMonitor_Local::CVarProcessEventsImmediate.GetValueOnAnyThread())
+int32 FUIDatasourceMonitor::FindPatternNode(FUIDatasourceHandle Scope, FStringView Pattern, bool bCreate)
+{
+	const int32* RootIndex = PatternRoots.Find(Scope);
+	if(!RootIndex && !bCreate)
+	{
+		return INDEX_NONE;
+	}
+
+	if(!RootIndex)
 	{
-		if (!QueuedEvents.Contains(Event))
+		bCleanupDelegates = true; // New scopes are a good time to sweep the roots of destroyed ones
+	}
+	int32 NodeIndex = RootIndex ? *RootIndex : PatternRoots.Add(Scope, AllocatePatternNode());
+	while(!Pattern.IsEmpty() && NodeIndex != INDEX_NONE)
+	{
+		int32 DotIndex;
+		const FStringView Segment = Pattern.FindChar(TEXT('.'), DotIndex) ? Pattern.Left(DotIndex) : Pattern;
+		Pattern.RightChopInline(Segment.Len() + 1);
+
+		int32 ChildIndex;
+		if(Segment.Equals(TEXT("**")))
 		{
-			QueuedEvents.Add(Event);
+			ChildIndex = PatternNodes[NodeIndex].AnyDescendants;
 		}
+		else if(Segment.Equals(TEXT("*")))
+		{
+			ChildIndex = PatternNodes[NodeIndex].AnyChild;
+		}
+		else
+		{
+			const int32* Child = PatternNodes[NodeIndex].Children.Find(FName(Segment));
+			ChildIndex = Child ? *Child : INDEX_NONE;
+		}
+
+		if(ChildIndex == INDEX_NONE && bCreate)
+		{
+			ChildIndex = AllocatePatternNode();
+			FUIDatasourcePatternNode& Node = PatternNodes[NodeIndex];
+			if(Segment.Equals(TEXT("**")))		Node.AnyDescendants = ChildIndex;
+			else if(Segment.Equals(TEXT("*")))	Node.AnyChild = ChildIndex;
+			else								Node.Children.Add(FName(Segment), ChildIndex);
+		}
+		NodeIndex = ChildIndex;
 	}
-	else
+	return NodeIndex;
+}
+
+int32 FUIDatasourceMonitor::AllocatePatternNode()
+{
+	return FreePatternNodes.IsEmpty() ? PatternNodes.AddDefaulted() : FreePatternNodes.Pop();
+}
+
+bool FUIDatasourceMonitor::PrunePatternNode(int32 NodeIndex, bool bForce)
+{
+	// @NOTE: Freeing never resizes PatternNodes, Node stays valid through the recursion
+	FUIDatasourcePatternNode& Node = PatternNodes[NodeIndex];
+	for(auto It = Node.Children.CreateIterator(); It; ++It)
 	{
-		if(const FOnDatasourceChangedDelegate* Delegates = EventHandlers.Find(Event.Handle))
+		if(PrunePatternNode(It->Value, bForce))
 		{
-			Delegates->Broadcast(Event);
+			It.RemoveCurrent();
 		}
 	}
+	if(Node.AnyChild != INDEX_NONE && PrunePatternNode(Node.AnyChild, bForce))
+	{
+		Node.AnyChild = INDEX_NONE;
+	}
+	if(Node.AnyDescendants != INDEX_NONE && PrunePatternNode(Node.AnyDescendants, bForce))
+	{
+		Node.AnyDescendants = INDEX_NONE;
+	}
+
+	if(bForce || (!Node.Delegates.IsBound() && Node.Children.IsEmpty() && Node.AnyChild == INDEX_NONE && Node.AnyDescendants == INDEX_NONE))
+	{
+		Node = {};
+		FreePatternNodes.Add(NodeIndex);
+		return true;
+	}
+	return false;
 }
 
-void FUIDatasourceMonitor::BindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+void FUIDatasourceMonitor::PrunePatternNodes()
 {
 	UIDATASOURCE_FUNC_TRACE()
 	
-	EventHandlers.FindOrAdd(Handle).AddUnique(Delegate);
+	for(auto It = PatternRoots.CreateIterator(); It; ++It)
+	{
+		// Destroyed scopes can't match anything anymore, their subscriptions go with them
+		if(PrunePatternNode(It->Value, !It->Key.Get()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	
+	if(PatternRoots.IsEmpty())
+	{
+		PatternNodes.Reset();
+		FreePatternNodes.Reset();
+	}
 }
 
-void FUIDatasourceMonitor::UnbindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate)
+void FUIDatasourceMonitor::BindDatasourcePatternEvent(FUIDatasourceHandle Scope, FStringView Pattern, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	int32 ColonIndex;
+	if(Pattern.FindChar(TEXT(':'), ColonIndex))
+	{
+		UE_LOG(LogDatasource, Error, TEXT("Pattern %.*s binds a struct field, field bindings aren't supported by pattern subscriptions."), Pattern.Len(), Pattern.GetData());
+		return;
+	}
+
+	if(!Scope.IsValid())
+	{
+		Scope = UUIDatasourceSubsystem::Get()->Pool.GetRootDatasource();
+	}
+	
+	const int32 NodeIndex = FindPatternNode(Scope, Pattern, true);
+	PatternNodes[NodeIndex].Delegates.AddUnique(Delegate);
+}
+
+void FUIDatasourceMonitor::UnbindDatasourcePatternEvent(FUIDatasourceHandle Scope, FStringView Pattern, const FOnDatasourceChangedDelegateBP& Delegate)
 {
-	if (FOnDatasourceChangedDelegate* Delegates = EventHandlers.Find(Handle))
+	if(!Scope.IsValid())
 	{
-		Delegates->Remove(Delegate);
-		if (!Delegates->IsBound())
+		Scope = UUIDatasourceSubsystem::Get()->Pool.GetRootDatasource();
+	}
+	
+	// Nodes left empty are pruned with the other delegate cleanups, so indices gathered by an ongoing dispatch stay valid
+	const int32 NodeIndex = FindPatternNode(Scope, Pattern, false);
+	if(NodeIndex != INDEX_NONE)
+	{
+		PatternNodes[NodeIndex].Delegates.Remove(Delegate);
+		if(!PatternNodes[NodeIndex].Delegates.IsBound())
 		{
 			bCleanupDelegates = true;
 		}
 	}
 }
 
+void FUIDatasourceMonitor::OnDatasourceAttached(const FUIDatasource* Datasource)
+{
+	if(PatternRoots.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<8>> MatchedNodes;
+	GatherPatternSubscriptions(Datasource, MatchedNodes);
+	if(!MatchedNodes.IsEmpty())
+	{
+		EnqueueEvent({ EUIDatasourceChangeEventKind::Attached, Datasource });
+	}
+}
+
+void FUIDatasourceMonitor::GatherPatternSubscriptions(const FUIDatasource* Datasource, TArray<int32, TInlineAllocator<8>>& OutNodes) const
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	// Walk up to the root, matching the segments below every ancestor that is a subscription scope
+	const FUIDatasourcePool* Pool = Datasource->GetPool();
+	TArray<FName, TInlineAllocator<16>> ReversedSegments;
+	TArray<FName, TInlineAllocator<16>> Segments;
+	for(const FUIDatasource* It = Datasource; It; It = Pool->GetDatasourceById(It->Parent))
+	{
+		if(const int32* RootIndex = ReversedSegments.IsEmpty() ? nullptr : PatternRoots.Find(FUIDatasourceHandle(It)))
+		{
+			Segments.Reset();
+			for(int32 Index = ReversedSegments.Num() - 1; Index >= 0; --Index)
+			{
+				Segments.Add(ReversedSegments[Index]);
+			}
+			MatchPattern(*RootIndex, Segments, OutNodes);
+		}
+		ReversedSegments.Add(It->Name);
+	}
+}
+
+void FUIDatasourceMonitor::MatchPattern(int32 NodeIndex, TConstArrayView<FName> Segments, TArray<int32, TInlineAllocator<8>>& OutNodes) const
+{
+	const FUIDatasourcePatternNode& Node = PatternNodes[NodeIndex];
+	if(Node.AnyDescendants != INDEX_NONE)
+	{
+		for(int32 Consumed = 0; Consumed <= Segments.Num(); ++Consumed)
+		{
+			MatchPattern(Node.AnyDescendants, Segments.RightChop(Consumed), OutNodes);
+		}
+	}
+	
+	if(Segments.IsEmpty())
+	{
+		if(Node.Delegates.IsBound())
+		{
+			OutNodes.AddUnique(NodeIndex);
+		}
+		return;
+	}
+
+	if(const int32* Child = Node.Children.Find(Segments[0]))
+	{
+		MatchPattern(*Child, Segments.RightChop(1), OutNodes);
+	}
+	if(Node.AnyChild != INDEX_NONE)
+	{
+		MatchPattern(Node.AnyChild, Segments.RightChop(1), OutNodes);
+	}
+}
+
+void FUIDatasourceMonitor::GatherPatternMatches(FUIDatasource* Scope, FStringView Pattern, TArray<FUIDatasource*>& OutMatches)
+{
+	if(!Scope)
+	{
+		return;
+	}
+	
+	FUIDatasourcePool* Pool = Scope->GetPool();
+	if(Pattern.IsEmpty())
+	{
+		OutMatches.AddUnique(Scope);
+		return;
+	}
+
+	int32 DotIndex;
+	const FStringView Segment = Pattern.FindChar(TEXT('.'), DotIndex) ? Pattern.Left(DotIndex) : Pattern;
+	const FStringView Rest = Pattern.RightChop(Segment.Len() + 1);
+	if(Segment.Equals(TEXT("**")))
+	{
+		GatherPatternMatches(Scope, Rest, OutMatches); // Matching no segment at all
+		for(FUIDatasource* Child = Pool->GetDatasourceById(Scope->FirstChild); Child; Child = Pool->GetDatasourceById(Child->NextSibling))
+		{
+			GatherPatternMatches(Child, Pattern, OutMatches);
+		}
+		return;
+	}
+
+	const bool bAnyChild = Segment.Equals(TEXT("*"));
+	const FName SegmentName = bAnyChild ? NAME_None : FName(Segment);
+	for(FUIDatasource* Child = Pool->GetDatasourceById(Scope->FirstChild); Child; Child = Pool->GetDatasourceById(Child->NextSibling))
+	{
+		if(bAnyChild || Child->Name == SegmentName)
+		{
+			GatherPatternMatches(Child, Rest, OutMatches);
+		}
+	}
+}
+
+void FUIDatasourceMonitor::BindDatasourceFieldEvent(FUIDatasourceHandle Handle, FName Field, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	if(FUIDatasource* Datasource = Handle.Get())
+	{
+		FOnDatasourceChangedDelegate& Delegates = FieldHandlers.FindOrAdd(Handle).FindOrAdd(Field);
+		if(!Delegates.Contains(Delegate))
+		{
+			Delegates.Add(Delegate);
+			AddObserver(Handle);
+		}
+		EnumAddFlags(Datasource->Flags, EUIDatasourceFlag::HasFieldBindings);
+	}
+}
+
+void FUIDatasourceMonitor::UnbindDatasourceFieldEvent(FUIDatasourceHandle Handle, FName Field, const FOnDatasourceChangedDelegateBP& Delegate)
+{
+	if(TMap<FName, FOnDatasourceChangedDelegate>* Fields = FieldHandlers.Find(Handle))
+	{
+		if(FOnDatasourceChangedDelegate* Delegates = Fields->Find(Field); Delegates && Delegates->Contains(Delegate))
+		{
+			Delegates->Remove(Delegate);
+			RemoveObserver(Handle);
+			if(!Delegates->IsBound())
+			{
+				bCleanupDelegates = true;
+			}
+		}
+	}
+}
+
+FUIDatasourceResolvedField FUIDatasourceResolvedField::Resolve(const UStruct* Struct, FName Field)
+{
+	FUIDatasourceResolvedField Resolved;
+	const UStruct* CurrentStruct = Struct;
+	TArray<FString> Segments;
+	Field.ToString().ParseIntoArray(Segments, TEXT("."));
+	for(int32 SegmentIndex = 0; SegmentIndex < Segments.Num(); ++SegmentIndex)
+	{
+		const FProperty* Property = CurrentStruct ? CurrentStruct->FindPropertyByName(FName(Segments[SegmentIndex])) : nullptr;
+		if(!Property)
+		{
+			return {}; // Unknown property, or path continues past a non struct property
+		}
+		
+		Resolved.Property = Property;
+		Resolved.Offset += Property->GetOffset_ForInternal();
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		CurrentStruct = StructProperty ? StructProperty->Struct : nullptr;
+	}
+	return Resolved;
+}
+
+const FUIDatasourceResolvedField* FUIDatasourceMonitor::ResolveField(const UScriptStruct* Struct, FName Field)
+{
+	const TPair<const UScriptStruct*, FName> Key(Struct, Field);
+	if(const FUIDatasourceResolvedField* Resolved = ResolvedFields.Find(Key))
+	{
+		return Resolved->Property ? Resolved : nullptr;
+	}
+
+	UIDATASOURCE_FUNC_TRACE()
+	
+	// Walk the property chain once, nested struct offsets add up so a field compare is a single Identical call afterward
+	const FUIDatasourceResolvedField Resolved = FUIDatasourceResolvedField::Resolve(Struct, Field);
+	if(!Resolved.Property)
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Field %s doesn't exist in struct %s, field bindings on it will fire on every change."), *Field.ToString(), *GetNameSafe(Struct));
+	}
+	
+	const FUIDatasourceResolvedField& Cached = ResolvedFields.Add(Key, Resolved);
+	return Cached.Property ? &Cached : nullptr;
+}
+
+void FUIDatasourceMonitor::QueueFieldEvents(const FUIDatasource* Datasource, const FInstancedStruct* OldValue, const FInstancedStruct& NewValue)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	const FUIDatasourceHandle Handle = Datasource;
+	const TMap<FName, FOnDatasourceChangedDelegate>* Fields = FieldHandlers.Find(Handle);
+	if(!Fields)
+	{
+		return;
+	}
+
+	const UScriptStruct* Struct = NewValue.GetScriptStruct();
+	const bool bSameLayout = OldValue && OldValue->GetScriptStruct() == Struct;
+	for(const TPair<FName, FOnDatasourceChangedDelegate>& Field : *Fields)
+	{
+		bool bFieldChanged = true;
+		if(bSameLayout)
+		{
+			if(!Struct)
+			{
+				bFieldChanged = false; // Both empty
+			}
+			else if(const FUIDatasourceResolvedField* Resolved = ResolveField(Struct, Field.Key))
+			{
+				bFieldChanged = !Resolved->Property->Identical(OldValue->GetMemory() + Resolved->Offset, NewValue.GetMemory() + Resolved->Offset);
+			}
+		}
+
+		if(bFieldChanged)
+		{
+			QueueDatasourceEvent({ EUIDatasourceChangeEventKind::FieldSet, Handle, Field.Key });
+		}
+	}
+}
+
 void FUIDatasourceMonitor::ProcessEvents()
 {
 	UIDATASOURCE_FUNC_TRACE()
+	EvaluateProviders();
+	EvaluateDerivations();
+	FlushRateLimitedEvents();
 	bProcessingEvents = true;
 	QueuedEventsBuffer = QueuedEvents;
 	QueuedEvents.Reset();
+	QueuedEventSet.Reset();
+	if(!SubtreeHandlers.IsEmpty())
+	{
+		// One epoch per flush, so bubbling stops at the first ancestor already reached by another change
+		SubtreeEpoch = SubtreeEpoch + 1 != 0 ? SubtreeEpoch + 1 : 1;
+		for (const FUIDatasourceChangeEventArgs& Event : QueuedEventsBuffer)
+		{
+			if(Event.Kind != EUIDatasourceChangeEventKind::Attached)
+			{
+				MarkSubtreeDirty(Event.Handle.Get());
+			}
+		}
+	}
+	
 	for (const FUIDatasourceChangeEventArgs& Event : QueuedEventsBuffer)
 	{
-		if(const FOnDatasourceChangedDelegate* Delegates = EventHandlers.Find(Event.Handle))
+		BroadcastEvent(Event);
+	}
+	BroadcastSubtreeEvents();
+
+	for(int32 Index = 0; Index < PendingFormatters.Num(); ++Index)
+	{
+		if(UUIDatasourceTextFormatter* Formatter = PendingFormatters[Index].Get())
 		{
-			// @TODO: Evaluate performance impact of this copy here, broadcasting this event might
-			// trigger some widgets to bind to some new datasources, this would potentially change EventHandlers size
-			// which means reallocating the underlying delegates, which we hold a pointer to in this scope
-			// making a local copy before broadcasting ensures we keep it valid.
-			FOnDatasourceChangedDelegate TmpDelegates = *Delegates;
-			TmpDelegates.Broadcast(Event);
+			Formatter->Flush();
 		}
 	}
+	PendingFormatters.Reset();
 
 	if (bCleanupDelegates)
 	{
@@ -77,6 +1247,47 @@ void FUIDatasourceMonitor::ProcessEvents()
 				It.RemoveCurrent();
 			}
 		}
+		
+		for(auto It = NativeEventHandlers.CreateIterator(); It; ++It)
+		{
+			if(!It->Value.IsBound())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		
+		for(auto It = SubtreeHandlers.CreateIterator(); It; ++It)
+		{
+			if(!It->Value.IsBound())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		
+		for(auto It = FieldHandlers.CreateIterator(); It; ++It)
+		{
+			for(auto FieldIt = It->Value.CreateIterator(); FieldIt; ++FieldIt)
+			{
+				if(!FieldIt->Value.IsBound())
+				{
+					FieldIt.RemoveCurrent();
+				}
+			}
+			
+			if(It->Value.IsEmpty())
+			{
+				if(FUIDatasource* Datasource = It->Key.Get())
+				{
+					EnumRemoveFlags(Datasource->Flags, EUIDatasourceFlag::HasFieldBindings);
+				}
+				It.RemoveCurrent();
+			}
+		}
+
+		if(!PatternRoots.IsEmpty())
+		{
+			PrunePatternNodes();
+		}
 		bCleanupDelegates = false;
 	}
 	bProcessingEvents = false;
@@ -85,5 +1296,32 @@ void FUIDatasourceMonitor::ProcessEvents()
 void FUIDatasourceMonitor::Clear()
 {
 	QueuedEvents.Empty();
+	QueuedEventSet.Empty();
 	EventHandlers.Empty();
+	NativeEventHandlers.Empty();
+	SubtreeHandlers.Empty();
+	Providers.Empty();
+	StaleProviders.Empty();
+	ObservedChangedHandlers.Empty();
+	DirtySubtrees.Empty();
+	PatternNodes.Empty();
+	FreePatternNodes.Empty();
+	PatternRoots.Empty();
+	FieldHandlers.Empty();
+	ResolvedFields.Empty();
+	RateLimits.Empty();
+	Derivations.Empty();
+	DerivedDependents.Empty();
+	DirtyDerivations.Empty();
+	WaitingDerivations.Empty();
+	for(const TWeakObjectPtr<UUIDatasourceTextFormatter>& Formatter : PendingFormatters)
+	{
+		if(Formatter.IsValid())
+		{
+			Formatter->CancelPending(); // Otherwise it never queues itself again
+		}
+	}
+	PendingFormatters.Empty();
+	PendingRateLimitedCount = 0;
+	SuppressedEventCount = 0;
 }
@@ -0,0 +1,133 @@
+// Copyright Sharundaar. All Rights Reserved.
+
+#include "UIDatasourceStringTable.h"
+
+#include "UIDatasourceDefines.h"
+
+FUIDatasourceStringTable::FUIDatasourceStringTable()
+{
+	Reset();
+}
+
+int32 FUIDatasourceStringTable::FindEntry(FStringView String, uint32 Hash) const
+{
+	for(auto It = Lookup.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const FEntry& Entry = Entries[It.Value()];
+		if(Entry.Len == String.Len() && FCString::Strncmp(&Arena[Entry.Offset], String.GetData(), Entry.Len) == 0)
+		{
+			return It.Value();
+		}
+	}
+	return INDEX_NONE;
+}
+
+FUIDatasourceInternedString FUIDatasourceStringTable::Intern(FStringView String)
+{
+	UIDATASOURCE_FUNC_TRACE();
+	
+	if(String.IsEmpty())
+	{
+		return {};
+	}
+
+	const uint32 Hash = FCrc::StrCrc32Len(String.GetData(), String.Len());
+	int32 EntryIndex = FindEntry(String, Hash);
+	if(EntryIndex == INDEX_NONE)
+	{
+		EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop() : Entries.AddDefaulted();
+		FEntry& Entry = Entries[EntryIndex];
+		Entry.Offset = Arena.Num();
+		Entry.Len = String.Len();
+		Entry.RefCount = 0;
+		Entry.Hash = Hash;
+
+		// String may be a view into the arena itself (e.g. a substring of a resolved string), grow first and re-derive it
+		const UPTRINT SourceOffset = reinterpret_cast<UPTRINT>(String.GetData()) - reinterpret_cast<UPTRINT>(Arena.GetData());
+		const bool bIsFromArena = Arena.Num() > 0 && SourceOffset < static_cast<UPTRINT>(Arena.Num()) * sizeof(TCHAR);
+		Arena.Reserve(Arena.Num() + String.Len() + 1);
+		const TCHAR* Source = bIsFromArena ? Arena.GetData() + SourceOffset / sizeof(TCHAR) : String.GetData();
+		Arena.Append(Source, String.Len());
+		Arena.Add(TEXT('\0'));
+		Lookup.Add(Hash, EntryIndex);
+	}
+
+	Entries[EntryIndex].RefCount++;
+	return { static_cast<uint32>(EntryIndex) };
+}
+
+void FUIDatasourceStringTable::AddRef(FUIDatasourceInternedString String)
+{
+	if(!String.IsEmpty())
+	{
+		checkf(Entries.IsValidIndex(String.Index) && Entries[String.Index].RefCount > 0, TEXT("Tried to reference a released interned string."));
+		Entries[String.Index].RefCount++;
+	}
+}
+
+void FUIDatasourceStringTable::Release(FUIDatasourceInternedString String)
+{
+	UIDATASOURCE_FUNC_TRACE();
+	
+	if(String.IsEmpty())
+	{
+		return;
+	}
+
+	checkf(Entries.IsValidIndex(String.Index) && Entries[String.Index].RefCount > 0, TEXT("Tried to release an interned string that isn't referenced anymore."));
+	FEntry& Entry = Entries[String.Index];
+	if(--Entry.RefCount == 0)
+	{
+		Lookup.RemoveSingle(Entry.Hash, String.Index);
+		WastedChars += Entry.Len + 1;
+		FreeEntries.Add(String.Index);
+
+		if(WastedChars > CompactThreshold && WastedChars > Arena.Num() / 2)
+		{
+			Compact();
+		}
+	}
+}
+
+FStringView FUIDatasourceStringTable::Resolve(FUIDatasourceInternedString String) const
+{
+	if(String.IsEmpty() || !Entries.IsValidIndex(String.Index))
+	{
+		return {};
+	}
+	
+	const FEntry& Entry = Entries[String.Index];
+	return FStringView(&Arena[Entry.Offset], Entry.Len);
+}
+
+void FUIDatasourceStringTable::Reset()
+{
+	Entries.Reset();
+	Entries.AddDefaulted(); // Reserve index 0 for the empty string
+	FreeEntries.Reset();
+	Arena.Reset();
+	Lookup.Reset();
+	WastedChars = 0;
+}
+
+void FUIDatasourceStringTable::Compact()
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	// Entry indices are what handles point to so they stay stable, only the offsets move
+	TArray<TCHAR> NewArena;
+	NewArena.Reserve(Arena.Num() - WastedChars);
+	for(int32 EntryIndex = 1; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		FEntry& Entry = Entries[EntryIndex];
+		if(Entry.RefCount > 0)
+		{
+			const int32 NewOffset = NewArena.Num();
+			NewArena.Append(&Arena[Entry.Offset], Entry.Len + 1);
+			Entry.Offset = NewOffset;
+		}
+	}
+
+	Arena = MoveTemp(NewArena);
+	WastedChars = 0;
+}
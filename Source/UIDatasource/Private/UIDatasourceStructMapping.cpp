@@ -0,0 +1,542 @@
+// Copyright Sharundaar. All Rights Reserved.
+
+#include "UIDatasourceStructMapping.h"
+
+#include "GameplayTagContainer.h"
+#include "InstancedStruct.h"
+#include "UIDatasource.h"
+#include "UIDatasourceSubsystem.h"
+#include "Misc/ScopeExit.h"
+#include "StructUtils/UserDefinedStruct.h"
+#include "UObject/UnrealType.h"
+
+namespace UIDatasourceStructMapping
+{
+	TMap<const UScriptStruct*, TUniquePtr<FUIDatasourceStructMapping>> Cache;
+	TArray<TUniquePtr<FUIDatasourceStructMapping>> InvalidatedMappings;
+	int32 BuildDepth = 0;
+	
+
+	FUIDatasourcePropertyMapping MapProperty(const FProperty* Property)
+	{
+		FUIDatasourcePropertyMapping Mapping;
+		Mapping.Property = Property;
+
+		if(Property->ArrayDim != 1)
+		{
+			return Mapping; // Static arrays aren't supported
+		}
+
+		if(CastField<FEnumProperty>(Property) || (CastField<FByteProperty>(Property) && CastField<FByteProperty>(Property)->Enum))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Enum;
+		}
+		else if(CastField<FFloatProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Float;
+		}
+		else if(CastField<FDoubleProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Double;
+		}
+		else if(CastField<FUInt64Property>(Property))
+		{
+			UE_LOG(LogDatasource, Warning, TEXT("uint64 property %s can't be stored in a datasource without losing values, it will be skipped."), *Property->GetFullName());
+		}
+		else if(const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property); NumericProperty && NumericProperty->IsInteger())
+		{
+			// uint32 values past INT32_MAX would wrap in an int32, widen them instead
+			Mapping.Kind = NumericProperty->GetSize() > sizeof(int32) || CastField<FUInt32Property>(Property) ? EUIDatasourcePropertyKind::Int64 : EUIDatasourcePropertyKind::Int;
+		}
+		else if(CastField<FBoolProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Bool;
+		}
+		else if(CastField<FNameProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Name;
+		}
+		else if(CastField<FTextProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Text;
+		}
+		else if(CastField<FStrProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::String;
+		}
+		else if(const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if(StructProperty->Struct == FUIDatasourceImage::StaticStruct())
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::Image;
+			}
+			else if(StructProperty->Struct == FGameplayTag::StaticStruct())
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::GameplayTag;
+			}
+			else if(StructProperty->Struct == TBaseStructure<FVector2D>::Get())
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::Vector2D;
+			}
+			else if(StructProperty->Struct == TBaseStructure<FLinearColor>::Get())
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::LinearColor;
+			}
+			else if(StructProperty->Struct == FInstancedStruct::StaticStruct())
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::InstancedStruct;
+			}
+			else
+			{
+				Mapping.Kind = EUIDatasourcePropertyKind::Struct;
+				Mapping.Nested = &FUIDatasourceStructMapping::Get(StructProperty->Struct);
+			}
+		}
+		else if(CastField<FArrayProperty>(Property))
+		{
+			Mapping.Kind = EUIDatasourcePropertyKind::Array;
+		}
+		
+		return Mapping;
+	}
+
+	void WriteValue(FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping* Inner, const void* ValuePtr);
+
+	void WriteArray(FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping& Inner, const void* ValuePtr)
+	{
+		if(EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::IsSink))
+		{
+			return;
+		}
+		
+		FScriptArrayHelper ArrayHelper(CastFieldChecked<FArrayProperty>(Mapping.Property), ValuePtr);
+		const int32 NewNum = ArrayHelper.Num();
+		
+		FUIArrayDatasource* Array = FUIArrayDatasource::Cast(Datasource);
+		if(!Array)
+		{
+			Array = FUIArrayDatasource::Make(Datasource);
+		}
+
+		// Resolve all the current items in a single pass, then grow the array in one go if needed
+		const int32 OldNum = Array->GetNum();
+		TArray<FUIDatasource*> Items;
+		Items.SetNumZeroed(FMath::Min(OldNum, NewNum));
+		FUIDatasourcePool* Pool = Array->GetPool();
+		for(FUIDatasource* ChildIt = Pool->GetDatasourceById(Array->FirstChild); ChildIt; ChildIt = Pool->GetDatasourceById(ChildIt->NextSibling))
+		{
+			const int32 ItemIndex = ChildIt->Name.GetNumber() - 1;
+			if(Items.IsValidIndex(ItemIndex) && ChildIt->Name.IsEqual(FUIArrayDatasource::ItemBaseName, ENameCase::IgnoreCase, false))
+			{
+				Items[ItemIndex] = ChildIt;
+			}
+		}
+
+		if(NewNum > OldNum)
+		{
+			TArray<FUIDatasource*> NewItems;
+			if(!Array->AppendN(NewNum - OldNum, &NewItems))
+			{
+				return;
+			}
+			Items.Append(NewItems);
+		}
+		else if(NewNum < OldNum)
+		{
+			Array->Set<int32>(NewNum); // Trailing items are kept around for reuse, same as FUIArrayDatasource::Empty
+		}
+
+		for(int32 ItemIndex = 0; ItemIndex < NewNum; ++ItemIndex)
+		{
+			if(Items[ItemIndex])
+			{
+				WriteValue(Items[ItemIndex], Inner, nullptr, ArrayHelper.GetRawPtr(ItemIndex));
+			}
+		}
+	}
+
+	void WriteValue(FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping* Inner, const void* ValuePtr)
+	{
+		switch(Mapping.Kind)
+		{
+		case EUIDatasourcePropertyKind::Int:
+			Datasource->Set<int32>(static_cast<int32>(CastFieldChecked<FNumericProperty>(Mapping.Property)->GetSignedIntPropertyValue(ValuePtr)));
+			break;
+		case EUIDatasourcePropertyKind::Enum:
+			if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Mapping.Property))
+			{
+				Datasource->Set<int32>(static_cast<int32>(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr)));
+			}
+			else
+			{
+				Datasource->Set<int32>(*static_cast<const uint8*>(ValuePtr));
+			}
+			break;
+		case EUIDatasourcePropertyKind::Float:
+			Datasource->Set<float>(*static_cast<const float*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Int64:
+			Datasource->Set<int64>(CastFieldChecked<FNumericProperty>(Mapping.Property)->GetSignedIntPropertyValue(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Double:
+			Datasource->Set<double>(*static_cast<const double*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Vector2D:
+			Datasource->Set<FVector2D>(*static_cast<const FVector2D*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::LinearColor:
+			Datasource->Set<FLinearColor>(*static_cast<const FLinearColor*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Bool:
+			Datasource->Set<bool>(CastFieldChecked<FBoolProperty>(Mapping.Property)->GetPropertyValue(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Name:
+			Datasource->Set<FName>(*static_cast<const FName*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Text:
+			Datasource->Set<FText>(*static_cast<const FText*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::String:
+			{
+				// Compare before copying, and keep interned strings interned
+				const FString& String = *static_cast<const FString*>(ValuePtr);
+				if(Datasource->Value.Value.IsType<FUIDatasourceInternedString>())
+				{
+					Datasource->SetInterned(String);
+				}
+				else
+				{
+					Datasource->Set<FString>(String);
+				}
+			}
+			break;
+		case EUIDatasourcePropertyKind::Image:
+			Datasource->Set<FUIDatasourceImage>(*static_cast<const FUIDatasourceImage*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::GameplayTag:
+			Datasource->Set<FGameplayTag>(*static_cast<const FGameplayTag*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::InstancedStruct:
+			Datasource->Set<FInstancedStruct>(*static_cast<const FInstancedStruct*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Struct:
+			Mapping.Nested->Write(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Array:
+			WriteArray(Datasource, Mapping, *Inner, ValuePtr);
+			break;
+		default: ;
+		}
+	}
+}
+
+namespace UIDatasourceStructMapping
+{
+	void ReportField(TArray<FString>& OutFields, const TArray<FName, TInlineAllocator<8>>& PathStack)
+	{
+		TStringBuilder<256> Path;
+		for(const FName& Segment : PathStack)
+		{
+			if(Path.Len() > 0)
+			{
+				Path << TEXT('.');
+			}
+			Path << Segment;
+		}
+		OutFields.Emplace(Path.ToView());
+	}
+
+	template<typename T>
+	bool ReadValueAs(const FUIDatasource* Datasource, void* ValuePtr)
+	{
+		return Datasource->TryGet<T>(*static_cast<T*>(ValuePtr));
+	}
+
+	void ReadValue(const FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping* Inner, void* ValuePtr, TArray<FName, TInlineAllocator<8>>& PathStack, FUIDatasourceStructReadResult& OutResult);
+
+	void ReadArray(const FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping& Inner, void* ValuePtr, TArray<FName, TInlineAllocator<8>>& PathStack, FUIDatasourceStructReadResult& OutResult)
+	{
+		const FUIArrayDatasource* Array = FUIArrayDatasource::Cast(Datasource);
+		if(!Array)
+		{
+			ReportField(OutResult.MistypedFields, PathStack);
+			return;
+		}
+
+		const int32 Num = Array->GetNum();
+		TArray<const FUIDatasource*> Items;
+		Items.SetNumZeroed(Num);
+		const FUIDatasourcePool* Pool = Array->GetPool();
+		for(const FUIDatasource* ChildIt = Pool->GetDatasourceById(Array->FirstChild); ChildIt; ChildIt = Pool->GetDatasourceById(ChildIt->NextSibling))
+		{
+			const int32 ItemIndex = ChildIt->Name.GetNumber() - 1;
+			if(Items.IsValidIndex(ItemIndex) && ChildIt->Name.IsEqual(FUIArrayDatasource::ItemBaseName, ENameCase::IgnoreCase, false))
+			{
+				Items[ItemIndex] = ChildIt;
+			}
+		}
+
+		FScriptArrayHelper ArrayHelper(CastFieldChecked<FArrayProperty>(Mapping.Property), ValuePtr);
+		ArrayHelper.Resize(Num);
+		for(int32 ItemIndex = 0; ItemIndex < Num; ++ItemIndex)
+		{
+			PathStack.Push(FName(FUIArrayDatasource::ItemBaseName, ItemIndex + 1)); // Same naming as array items
+			ReadValue(Items[ItemIndex], Inner, nullptr, ArrayHelper.GetRawPtr(ItemIndex), PathStack, OutResult);
+			PathStack.Pop();
+		}
+	}
+
+	void ReadValue(const FUIDatasource* Datasource, const FUIDatasourcePropertyMapping& Mapping, const FUIDatasourcePropertyMapping* Inner, void* ValuePtr, TArray<FName, TInlineAllocator<8>>& PathStack, FUIDatasourceStructReadResult& OutResult)
+	{
+		if(!Datasource)
+		{
+			ReportField(OutResult.MissingFields, PathStack);
+			return;
+		}
+
+		bool bIsValid = true;
+		switch(Mapping.Kind)
+		{
+		case EUIDatasourcePropertyKind::Int:
+		case EUIDatasourcePropertyKind::Enum:
+			{
+				int32 Value;
+				bIsValid = Datasource->TryGet<int32>(Value);
+				if(bIsValid)
+				{
+					if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Mapping.Property))
+					{
+						EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value));
+					}
+					else
+					{
+						CastFieldChecked<FNumericProperty>(Mapping.Property)->SetIntPropertyValue(ValuePtr, static_cast<int64>(Value));
+					}
+				}
+			}
+			break;
+		case EUIDatasourcePropertyKind::Float:
+			bIsValid = ReadValueAs<float>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Int64:
+			{
+				int64 Value;
+				bIsValid = Datasource->TryGet<int64>(Value);
+				if(bIsValid)
+				{
+					CastFieldChecked<FNumericProperty>(Mapping.Property)->SetIntPropertyValue(ValuePtr, Value);
+				}
+			}
+			break;
+		case EUIDatasourcePropertyKind::Double:
+			bIsValid = ReadValueAs<double>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Vector2D:
+			bIsValid = ReadValueAs<FVector2D>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::LinearColor:
+			bIsValid = ReadValueAs<FLinearColor>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Bool:
+			{
+				bool Value;
+				bIsValid = Datasource->TryGet<bool>(Value);
+				if(bIsValid)
+				{
+					CastFieldChecked<FBoolProperty>(Mapping.Property)->SetPropertyValue(ValuePtr, Value);
+				}
+			}
+			break;
+		case EUIDatasourcePropertyKind::Name:
+			bIsValid = ReadValueAs<FName>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Text:
+			bIsValid = ReadValueAs<FText>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::String:
+			bIsValid = Datasource->TryGetString(*static_cast<FString*>(ValuePtr));
+			break;
+		case EUIDatasourcePropertyKind::Image:
+			bIsValid = ReadValueAs<FUIDatasourceImage>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::GameplayTag:
+			bIsValid = ReadValueAs<FGameplayTag>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::InstancedStruct:
+			bIsValid = ReadValueAs<FInstancedStruct>(Datasource, ValuePtr);
+			break;
+		case EUIDatasourcePropertyKind::Struct:
+			Mapping.Nested->Read(Datasource, ValuePtr, PathStack, OutResult);
+			break;
+		case EUIDatasourcePropertyKind::Array:
+			ReadArray(Datasource, Mapping, *Inner, ValuePtr, PathStack, OutResult);
+			break;
+		default: ;
+		}
+
+		if(!bIsValid)
+		{
+			ReportField(OutResult.MistypedFields, PathStack);
+		}
+	}
+}
+
+const FUIDatasourceStructMapping& FUIDatasourceStructMapping::Get(const UScriptStruct* Struct)
+{
+	check(IsInGameThread());
+	
+	if(const TUniquePtr<FUIDatasourceStructMapping>* Existing = UIDatasourceStructMapping::Cache.Find(Struct))
+	{
+		// Nested lookups while building hit mappings that are still being filled, only complete ones are checked
+		if(UIDatasourceStructMapping::BuildDepth > 0 || !(*Existing)->IsStale())
+		{
+			return **Existing;
+		}
+		
+		// Other mappings may point to the stale one as a nested struct, rebuild everything
+		UE_LOG(LogDatasource, Verbose, TEXT("Struct %s changed since its datasource mapping was built, rebuilding the mappings."), *Struct->GetName());
+		Invalidate();
+	}
+
+	UIDATASOURCE_FUNC_TRACE();
+
+	// @NOTE: Registered before filling the fields so self referencing structs (through TArray) resolve to this mapping
+	FUIDatasourceStructMapping& Mapping = *UIDatasourceStructMapping::Cache.Add(Struct, MakeUnique<FUIDatasourceStructMapping>());
+	Mapping.Struct = Struct;
+	Mapping.WeakStruct = Struct;
+	Mapping.FirstProperty = Struct->ChildProperties;
+	Mapping.StructureSize = Struct->GetStructureSize();
+
+	UIDatasourceStructMapping::BuildDepth++;
+	ON_SCOPE_EXIT { UIDatasourceStructMapping::BuildDepth--; };
+
+	const bool bIsUserDefined = Struct->IsA<UUserDefinedStruct>();
+	for(TFieldIterator<FProperty> PropertyIt(Struct); PropertyIt; ++PropertyIt)
+	{
+		const FProperty* Property = *PropertyIt;
+		FUIDatasourceStructFieldMapping Field;
+		Field.Name = bIsUserDefined ? FName(Property->GetAuthoredName()) : Property->GetFName(); // User defined struct properties have mangled names
+		Field.Offset = Property->GetOffset_ForInternal();
+		Field.Value = UIDatasourceStructMapping::MapProperty(Property);
+		if(Field.Value.Kind == EUIDatasourcePropertyKind::Array)
+		{
+			Field.Inner = UIDatasourceStructMapping::MapProperty(CastFieldChecked<FArrayProperty>(Property)->Inner);
+			if(Field.Inner.Kind == EUIDatasourcePropertyKind::Array)
+			{
+				Field.Inner.Kind = EUIDatasourcePropertyKind::Unsupported; // Can't have nested TArray in reflected properties anyway
+			}
+		}
+
+		if(Field.Value.Kind == EUIDatasourcePropertyKind::Unsupported || (Field.Value.Kind == EUIDatasourcePropertyKind::Array && Field.Inner.Kind == EUIDatasourcePropertyKind::Unsupported))
+		{
+			UE_LOG(LogDatasource, Verbose, TEXT("Property %s of %s has no datasource equivalent, it will be skipped."), *Property->GetName(), *Struct->GetName());
+			continue;
+		}
+
+		Mapping.FieldIndices.Add(Field.Name, Mapping.Fields.Num());
+		Mapping.Fields.Add(MoveTemp(Field));
+	}
+
+	return Mapping;
+}
+
+void FUIDatasourceStructMapping::Invalidate()
+{
+	check(IsInGameThread());
+	
+	for(TPair<const UScriptStruct*, TUniquePtr<FUIDatasourceStructMapping>>& Pair : UIDatasourceStructMapping::Cache)
+	{
+		UIDatasourceStructMapping::InvalidatedMappings.Add(MoveTemp(Pair.Value));
+	}
+	UIDatasourceStructMapping::Cache.Reset();
+}
+
+void FUIDatasourceStructMapping::ReleaseInvalidated()
+{
+	check(IsInGameThread());
+	UIDatasourceStructMapping::InvalidatedMappings.Reset();
+}
+
+bool FUIDatasourceStructMapping::IsStale() const
+{
+	TArray<const FUIDatasourceStructMapping*, TInlineAllocator<8>> Stack = { this };
+	TSet<const FUIDatasourceStructMapping*, DefaultKeyFuncs<const FUIDatasourceStructMapping*>, TInlineSetAllocator<8>> Visited;
+	while(!Stack.IsEmpty())
+	{
+		const FUIDatasourceStructMapping* Mapping = Stack.Pop();
+		bool bAlreadyVisited = false;
+		Visited.Add(Mapping, &bAlreadyVisited);
+		if(bAlreadyVisited)
+		{
+			continue; // Self referencing structs
+		}
+		
+		const UScriptStruct* CurrentStruct = Mapping->WeakStruct.Get();
+		if(CurrentStruct != Mapping->Struct || CurrentStruct->ChildProperties != Mapping->FirstProperty || CurrentStruct->GetStructureSize() != Mapping->StructureSize)
+		{
+			return true;
+		}
+		
+		for(const FUIDatasourceStructFieldMapping& Field : Mapping->Fields)
+		{
+			const FUIDatasourcePropertyMapping& Value = Field.Value.Kind == EUIDatasourcePropertyKind::Array ? Field.Inner : Field.Value;
+			if(Value.Nested)
+			{
+				Stack.Add(Value.Nested);
+			}
+		}
+	}
+	return false;
+}
+
+void FUIDatasourceStructMapping::GatherFieldDatasources(const FUIDatasource* Parent, TArray<FUIDatasource*, TInlineAllocator<32>>& OutDatasources) const
+{
+	OutDatasources.Reset();
+	OutDatasources.SetNumZeroed(Fields.Num());
+	
+	FUIDatasourcePool* Pool = Parent->GetPool();
+	for(FUIDatasource* ChildIt = Pool->GetDatasourceById(Parent->FirstChild); ChildIt; ChildIt = Pool->GetDatasourceById(ChildIt->NextSibling))
+	{
+		if(const int32* FieldIndex = FieldIndices.Find(ChildIt->Name))
+		{
+			OutDatasources[*FieldIndex] = ChildIt;
+		}
+	}
+}
+
+void FUIDatasourceStructMapping::Write(FUIDatasource* Parent, const void* StructData) const
+{
+	UIDATASOURCE_FUNC_TRACE();
+	
+	if(EnumHasAllFlags(Parent->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return;
+	}
+	
+	TArray<FUIDatasource*, TInlineAllocator<32>> FieldDatasources;
+	GatherFieldDatasources(Parent, FieldDatasources);
+	
+	FUIDatasourcePool* Pool = Parent->GetPool();
+	for(int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+	{
+		const FUIDatasourceStructFieldMapping& Field = Fields[FieldIndex];
+		FUIDatasource* FieldDatasource = FieldDatasources[FieldIndex] ? FieldDatasources[FieldIndex] : Pool->CreateChildDatasource(Parent, Field.Name);
+		UIDatasourceStructMapping::WriteValue(FieldDatasource, Field.Value, &Field.Inner, static_cast<const uint8*>(StructData) + Field.Offset);
+	}
+}
+
+void FUIDatasourceStructMapping::Read(const FUIDatasource* Parent, void* StructData, TArray<FName, TInlineAllocator<8>>& PathStack, FUIDatasourceStructReadResult& OutResult) const
+{
+	UIDATASOURCE_FUNC_TRACE();
+	
+	TArray<FUIDatasource*, TInlineAllocator<32>> FieldDatasources;
+	GatherFieldDatasources(Parent, FieldDatasources);
+	
+	for(int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+	{
+		const FUIDatasourceStructFieldMapping& Field = Fields[FieldIndex];
+		PathStack.Push(Field.Name);
+		UIDatasourceStructMapping::ReadValue(FieldDatasources[FieldIndex], Field.Value, &Field.Inner, static_cast<uint8*>(StructData) + Field.Offset, PathStack, OutResult);
+		PathStack.Pop();
+	}
+}
@@ -0,0 +1,83 @@
+﻿// Copyright Sharundaar. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FUIDatasource;
+struct FUIDatasourceStructReadResult;
+class FField;
+class FProperty;
+class UScriptStruct;
+
+// How a reflected property maps onto a datasource
+enum class EUIDatasourcePropertyKind : uint8
+{
+	Unsupported,
+	Int,		// Signed integer properties up to 32 bits and unsigned ones up to 16 bits, stored as int32
+	Int64,		// int64 and uint32 properties, uint64 isn't supported since it can't be stored without losing values
+	Enum,		// Enum and byte enum properties, stored as int32
+	Float,
+	Double,
+	Bool,
+	Name,
+	Text,
+	String,
+	Image,
+	GameplayTag,
+	Vector2D,
+	LinearColor,
+	InstancedStruct,
+	Struct,		// Nested struct, maps to a child subtree
+	Array,		// TArray, maps to an array datasource
+};
+
+struct FUIDatasourceStructMapping;
+
+struct FUIDatasourcePropertyMapping
+{
+	EUIDatasourcePropertyKind Kind = EUIDatasourcePropertyKind::Unsupported;
+	const FProperty* Property = nullptr;
+	const FUIDatasourceStructMapping* Nested = nullptr; // Struct kind only
+};
+
+struct FUIDatasourceStructFieldMapping
+{
+	FName Name; // Child datasource name
+	int32 Offset = 0;
+	FUIDatasourcePropertyMapping Value;
+	FUIDatasourcePropertyMapping Inner; // Array kind only, describes the elements
+};
+
+// Property to child datasource mapping of a UScriptStruct, built once per struct type
+struct FUIDatasourceStructMapping
+{
+	const UScriptStruct* Struct = nullptr;
+	TArray<FUIDatasourceStructFieldMapping> Fields;
+	TMap<FName, int32> FieldIndices;
+
+	// Layout the mapping was built from, a struct that got garbage collected, recompiled or hot reloaded no longer matches it
+	TWeakObjectPtr<const UScriptStruct> WeakStruct;
+	const FField* FirstProperty = nullptr;
+	int32 StructureSize = 0;
+
+	// Game thread only, the returned mapping stays valid until the end of the frame, don't hold on to it longer
+	static const FUIDatasourceStructMapping& Get(const UScriptStruct* Struct);
+
+	// Drop every cached mapping, they are rebuilt on the next Get. Dropped mappings are only freed by ReleaseInvalidated
+	// since a write or read in progress may still be walking them
+	static void Invalidate();
+	// Game thread only, called at the end of the frame
+	static void ReleaseInvalidated();
+
+	// Whether Struct or any struct nested in it changed since the mapping was built
+	bool IsStale() const;
+
+	// Resolve the child datasource of every field in a single pass over Parent children, missing ones are left null
+	void GatherFieldDatasources(const FUIDatasource* Parent, TArray<FUIDatasource*, TInlineAllocator<32>>& OutDatasources) const;
+	
+	void Write(FUIDatasource* Parent, const void* StructData) const;
+	
+	// PathStack holds the field names leading to Parent, only used to report failed fields
+	void Read(const FUIDatasource* Parent, void* StructData, TArray<FName, TInlineAllocator<8>>& PathStack, FUIDatasourceStructReadResult& OutResult) const;
+};
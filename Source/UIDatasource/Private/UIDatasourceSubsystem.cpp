@@ -25,33 +25,123 @@ static const FUIDatasource MakeSinkDatasource()
 }  
 FUIDatasource FUIDatasourcePool::SinkDatasource = MakeSinkDatasource();
 
+// Scoped structural write, lets FindDatasourceConcurrent know it has to retry its lookup
+struct FUIDatasourceStructureWriteScope
+{
+	explicit FUIDatasourceStructureWriteScope(FUIDatasourcePool& InPool) : Pool(InPool) { Pool.BeginStructureWrite(); }
+	~FUIDatasourceStructureWriteScope() { Pool.EndStructureWrite(); }
+	FUIDatasourcePool& Pool;
+};
+
+void FUIDatasourcePool::BeginStructureWrite()
+{
+	if(StructureWriteDepth++ == 0)
+	{
+		FPlatformAtomics::AtomicStore_Relaxed(&StructureSequence, StructureSequence + 1);
+		FPlatformMisc::MemoryBarrier();
+	}
+}
+
+void FUIDatasourcePool::EndStructureWrite()
+{
+	check(StructureWriteDepth > 0);
+	if(--StructureWriteDepth == 0)
+	{
+		FPlatformMisc::MemoryBarrier();
+		FPlatformAtomics::AtomicStore_Relaxed(&StructureSequence, StructureSequence + 1);
+	}
+}
+
 FUIDatasource* FUIDatasourcePool::Allocate()
 {
 	UIDATASOURCE_FUNC_TRACE();
 
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
 	if (!ensureMsgf(FirstFree < Datasources.Num(), TEXT("No more room to allocate new datasource, consider cleaning unused Datasource or increase pool size.")))
 	{
 		UE_LOG(LogDatasource, Error, TEXT("No more room to allocate new datasource, consider cleaning unused Datasource or increase pool size."));
 		return nullptr;
 	}
 
-	const EUIDatasourceId NewId = static_cast<EUIDatasourceId>(FirstFree);
-	FUIDatasource* Alloc = &Datasources[FirstFree++];
-	const FUIDatasourceGeneration Generation = Alloc->Generation;
+	const int32 Index = FirstFree++;
+	while (FirstFree < Datasources.Num() && IsValid(&Datasources[FirstFree]))
+	{
+		FirstFree++;
+	}
+	return InitializeAllocated(Index);
+}
+
+bool FUIDatasourcePool::AllocateMany(int32 Count, TArray<FUIDatasource*>& OutAllocated)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	if (Capacity() - Num() < Count)
+	{
+		UE_LOG(LogDatasource, Error, TEXT("No room to allocate %d datasources, consider cleaning unused Datasource or increase pool size."), Count);
+		return false;
+	}
+
+	// Single sweep over the free slots, instead of rescanning for the next free one after each allocation
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
+	OutAllocated.Reserve(OutAllocated.Num() + Count);
+	int32 Index = FirstFree;
+	for (int32 Allocated = 0; Allocated < Count; ++Index)
+	{
+		if (!IsValid(&Datasources[Index]))
+		{
+			OutAllocated.Add(InitializeAllocated(Index));
+			++Allocated;
+		}
+	}
+	FirstFree = Index;
 	while (FirstFree < Datasources.Num() && IsValid(&Datasources[FirstFree]))
 	{
 		FirstFree++;
 	}
+	return true;
+}
+
+FUIDatasource* FUIDatasourcePool::InitializeAllocated(int32 Index)
+{
+	const EUIDatasourceId NewId = static_cast<EUIDatasourceId>(Index);
+	FUIDatasource* Alloc = &Datasources[Index];
+	const FUIDatasourceGeneration Generation = Alloc->Generation;
 	AllocatedCount++;
 
-	*Alloc = {};
+	// @NOTE: Reset field by field instead of assigning a default datasource, ValueSequence needs to stay
+	// monotonic for the whole write window otherwise a concurrent reader could validate a torn value
+	Alloc->BeginValueWrite();
+	Alloc->Name = NAME_None;
 	Alloc->Id = NewId;
 	Alloc->Generation = Generation;
+	Alloc->Parent = EUIDatasourceId::Invalid;
+	Alloc->FirstChild = EUIDatasourceId::Invalid;
+	Alloc->NextSibling = EUIDatasourceId::Invalid;
+	Alloc->PrevSibling = EUIDatasourceId::Invalid;
+	Alloc->Flags = EUIDatasourceFlag::None;
+	Alloc->Value.Clear();
+	Alloc->ValueVersion = 0;
+	Alloc->SubtreeVersion = 0;
+#if WITH_UIDATASOURCE_MONITOR
+	Alloc->SubtreeEpoch = 0;
+	Alloc->ObserverCount = 0;
+	Alloc->SubtreeObserverCount = 0;
+#else
+	Alloc->OnDatasourceChanged.Clear();
+	Alloc->OnDatasourceChangedNative.Clear();
+#endif
+	Alloc->EndValueWrite();
 	return Alloc;
 }
 
 void FUIDatasourcePool::Clear()
 {
+	// Readers only guard against the tree changing, not against the storage going away under them
+#if DO_CHECK
+	checkf(FPlatformAtomics::AtomicRead(&ConcurrentReaders) == 0, TEXT("Datasource pool cleared while concurrent reads are in flight."));
+#endif
+	
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
 	Datasources.Empty();
 	Initialize();
 }
@@ -61,6 +151,11 @@ void FUIDatasourcePool::Initialize()
 	UIDATASOURCE_FUNC_TRACE();
 	
 	Datasources.SetNumZeroed(ChunkSize);
+	AllocatedCount = 0;
+	Strings.Reset();
+	ChangePolicies.Reset();
+	StructHashes.Reset();
+	Aliases.Reset();
 	
 	FUIDatasourceHeader* Header = reinterpret_cast<FUIDatasourceHeader*>(&Datasources[static_cast<int>(EUIDatasourceId::Header)]);
 	*Header = { this };
@@ -74,6 +169,12 @@ void FUIDatasourcePool::Initialize()
 	FirstFree = ToIndex(EUIDatasourceId::Root) + 1;
 }
 
+void FUIDatasourcePool::InitializeAsStaging()
+{
+	bIsStaging = true;
+	Initialize();
+}
+
 FUIDatasourceHeader* FUIDatasourcePool::GetHeaderDatasource()
 {
 	return reinterpret_cast<FUIDatasourceHeader*>(&Datasources[ToIndex(EUIDatasourceId::Header)]);
@@ -109,6 +210,7 @@ static FUIDatasource* AllocateAndAttachDatasource(FUIDatasourcePool& Pool, FUIDa
 	UIDATASOURCE_FUNC_TRACE();
 	
 	// @NOTE: Creates a new datasource and attach it to the chain
+	FUIDatasourceStructureWriteScope StructureWrite(Pool);
 	FUIDatasource* NewDatasource = Pool.Allocate();
 	if (!NewDatasource)
 	{
@@ -123,7 +225,14 @@ static FUIDatasource* AllocateAndAttachDatasource(FUIDatasourcePool& Pool, FUIDa
 	}
 	NewDatasource->NextSibling = Parent->FirstChild;
 	Parent->FirstChild = NewDatasource->Id;
-	UUIDatasourceSubsystem::LogDatasourceChange({NewDatasource});
+	if(!Pool.IsStaging())
+	{
+		UUIDatasourceSubsystem::LogDatasourceChange({NewDatasource});
+		Pool.StampVersion(NewDatasource);
+#if WITH_UIDATASOURCE_MONITOR
+		UUIDatasourceSubsystem::Get()->Monitor.OnDatasourceAttached(NewDatasource);
+#endif
+	}
 	return NewDatasource;
 }
 
@@ -145,6 +254,12 @@ static FUIDatasource* FindOrCreateDatasource_Internal(FUIDatasourcePool& Pool, F
 		return Current;
 	}
 
+	Current = Pool.ResolveAlias(Current);
+	if(!Current)
+	{
+		return &FUIDatasourcePool::SinkDatasource; // Dangling alias, swallow whatever is done through it
+	}
+
 	while(!Path.IsEmpty())
 	{
 		FName SearchName;
@@ -170,7 +285,11 @@ static FUIDatasource* FindOrCreateDatasource_Internal(FUIDatasourcePool& Pool, F
 			ChildIt = AllocateAndAttachDatasource(Pool, Current, SearchName);
 		}
 
-		Current = ChildIt;
+		Current = Pool.ResolveAlias(ChildIt);
+		if(!Current)
+		{
+			return &FUIDatasourcePool::SinkDatasource;
+		}
 	}
 
 	return Current;
@@ -193,6 +312,7 @@ static FUIDatasource* FindDatasource_Internal(const FUIDatasourcePool& Pool, con
 		return const_cast<FUIDatasource*>(Current);
 	}
 
+	Current = Pool.ResolveAlias(Current);
 	while(Current && !Path.IsEmpty())
 	{
 		FName SearchName = FName();
@@ -218,7 +338,7 @@ static FUIDatasource* FindDatasource_Internal(const FUIDatasourcePool& Pool, con
 			ChildIt = Pool.GetDatasourceById(ChildIt->NextSibling);
 		}
 
-		Current = ChildIt;
+		Current = Pool.ResolveAlias(ChildIt);
 	}
 
 	// @NOTE: const_cast here as the pool owns the datasource memory, but from a user
@@ -227,10 +347,87 @@ static FUIDatasource* FindDatasource_Internal(const FUIDatasourcePool& Pool, con
 }
 
 
+template<typename CHARTYPE>
+static FUIDatasourceHandle FindDatasourceConcurrent_Internal(const FUIDatasourcePool& Pool, FUIDatasourceHandle ParentHandle, TStringView<CHARTYPE> Path)
+{
+	UIDATASOURCE_TRACE("FindDatasourceConcurrent");
+
+	// Split the path once up front, FName lookups are thread safe and we don't want to redo them on every retry
+	TArray<FName, TInlineAllocator<16>> SearchNames;
+	int32 DotPos;
+	while(!Path.IsEmpty())
+	{
+		FName SearchName;
+		if(Path.FindChar('.', DotPos))
+		{
+			SearchName = FName(TStringView<CHARTYPE>(Path.GetData(), DotPos), FNAME_Find);
+			Path.RightChopInline(DotPos + 1);
+		}
+		else
+		{
+			SearchName = FName(Path, FNAME_Find);
+			Path.Reset(); // Finished iterating
+		}
+
+		if(SearchName.IsNone())
+		{
+			return {}; // FName has never been registered, as such it can't ID a datasource, so early bail out
+		}
+		SearchNames.Add(SearchName);
+	}
+
+	FUIDatasourceGeneration ParentGeneration;
+	EUIDatasourceId ParentId;
+	UIDatasource_UnpackId(ParentHandle.Id, ParentGeneration, ParentId);
+
+	Pool.BeginConcurrentRead();
+	ON_SCOPE_EXIT { Pool.EndConcurrentRead(); };
+	
+	for(int32 Attempt = 0; Attempt < FUIDatasourcePool::MaxConcurrentReadAttempts; ++Attempt)
+	{
+		const int32 SequenceBegin = Pool.ReadStructureSequence();
+		if(SequenceBegin & 1)
+		{
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		const FUIDatasource* Current = ParentId != EUIDatasourceId::Invalid ? Pool.GetDatasourceById(ParentId) : Pool.GetRootDatasource();
+		if(ParentId != EUIDatasourceId::Invalid && Current->Generation != ParentGeneration)
+		{
+			Current = nullptr;
+		}
+
+		// @NOTE: We might walk a chain that is being relinked, bound the number of steps so a torn link can't loop us forever,
+		// the sequence check below discards whatever we found in that case
+		int32 StepBudget = FUIDatasourcePool::Capacity();
+		for(int32 NameIndex = 0; Current && NameIndex < SearchNames.Num() && StepBudget > 0; ++NameIndex)
+		{
+			const FUIDatasource* ChildIt = Pool.GetDatasourceById(Current->FirstChild);
+			while(ChildIt && ChildIt->Name != SearchNames[NameIndex] && --StepBudget > 0)
+			{
+				ChildIt = Pool.GetDatasourceById(ChildIt->NextSibling);
+			}
+			Current = ChildIt && !EnumHasAllFlags(ChildIt->Flags, EUIDatasourceFlag::IsAlias) ? ChildIt : nullptr; // Alias table isn't safe to read here
+		}
+		
+		const FUIDatasourceHandle Result = Current && StepBudget > 0 ? FUIDatasourceHandle(Current) : FUIDatasourceHandle();
+		FPlatformMisc::MemoryBarrier();
+		if(Pool.ReadStructureSequence() == SequenceBegin)
+		{
+			return Result;
+		}
+	}
+
+	return {};
+}
+
 FUIDatasource* FUIDatasourcePool::FindOrCreateDatasource(FUIDatasource* Parent, FWideStringView Path) { return FindOrCreateDatasource_Internal(*this, Parent, Path); }
 FUIDatasource* FUIDatasourcePool::FindOrCreateDatasource(FUIDatasource* Parent, FAnsiStringView Path) { return FindOrCreateDatasource_Internal(*this, Parent, Path); }
 FUIDatasource* FUIDatasourcePool::FindDatasource(const FUIDatasource* Parent, FWideStringView Path) const { return FindDatasource_Internal(*this, Parent, Path); }
 FUIDatasource* FUIDatasourcePool::FindDatasource(const FUIDatasource* Parent, FAnsiStringView Path) const { return FindDatasource_Internal(*this, Parent, Path); }
+FUIDatasourceHandle FUIDatasourcePool::FindDatasourceConcurrent(FUIDatasourceHandle Parent, FWideStringView Path) const { return FindDatasourceConcurrent_Internal(*this, Parent, Path); }
+FUIDatasourceHandle FUIDatasourcePool::FindDatasourceConcurrent(FUIDatasourceHandle Parent, FAnsiStringView Path) const { return FindDatasourceConcurrent_Internal(*this, Parent, Path); }
 
 FUIDatasource* FUIDatasourcePool::FindOrCreateChildDatasource(FUIDatasource* Parent, FName Name)
 {
@@ -251,6 +448,13 @@ FUIDatasource* FUIDatasourcePool::FindOrCreateChildDatasource(FUIDatasource* Par
 		return Parent;
 	}
 
+	// Children of the alias itself would be unreachable, path lookups resolve it before looking at children
+	Parent = ResolveAlias(Parent);
+	if(!Parent)
+	{
+		return &SinkDatasource;
+	}
+
 	FUIDatasource* ChildIt = GetDatasourceById(Parent->FirstChild);
 	while(ChildIt && ChildIt->Name != Name)
 	{
@@ -265,6 +469,30 @@ FUIDatasource* FUIDatasourcePool::FindOrCreateChildDatasource(FUIDatasource* Par
 	return ChildIt;
 }
 
+FUIDatasource* FUIDatasourcePool::CreateChildDatasource(FUIDatasource* Parent, FName Name)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	if(!Parent)
+	{
+		Parent = GetRootDatasource();
+	}
+	
+	if(EnumHasAllFlags(Parent->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return Parent;
+	}
+
+	Parent = ResolveAlias(Parent);
+	if(!Parent)
+	{
+		return &SinkDatasource;
+	}
+	
+	checkSlow(FindChildDatasource(Parent, Name) == nullptr);
+	return AllocateAndAttachDatasource(*this, Parent, Name);
+}
+
 FUIDatasource* FUIDatasourcePool::FindChildDatasource(const FUIDatasource* Parent, FName Name)
 {
 	UIDATASOURCE_FUNC_TRACE();
@@ -302,18 +530,78 @@ void FUIDatasourcePool::DestroyDatasource(FUIDatasource* Datasource)
 		return;
 	}
 	
-	FirstFree = FMath::Min(FirstFree, static_cast<int>(Datasource->Id));
-
-	for(FUIDatasource* Child = GetDatasourceById(Datasource->FirstChild); Child; Child = GetDatasourceById(Child->NextSibling))
+	// Gather the whole subtree once, iteratively so deep trees can't blow the stack
+	TArray<FUIDatasource*, TInlineAllocator<64>> Destroyed;
+	Destroyed.Add(Datasource);
+	for(int32 Index = 0; Index < Destroyed.Num(); ++Index)
 	{
-		DestroyDatasource(Child);
+		for(FUIDatasource* Child = GetDatasourceById(Destroyed[Index]->FirstChild); Child; Child = GetDatasourceById(Child->NextSibling))
+		{
+			Destroyed.Add(Child);
+		}
+	}
+	
+#if WITH_UIDATASOURCE_MONITOR
+	// Observed changes are told once the subtree is gone and the structure write is over, their callbacks may well destroy,
+	// move or write datasources
+	TArray<FUIDatasourceDeferredObservedChange> DeferredObservedChanges;
+	ON_SCOPE_EXIT
+	{
+		FUIDatasourceMonitor::NotifyObservedChanged(DeferredObservedChanges);
+	};
+#endif
+	
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
+	if(!bIsStaging)
+	{
+		// A single record for the whole subtree, and every monitor table purged in one pass while the handles still resolve
+		UUIDatasourceSubsystem::LogDatasourceChange({Datasource, Destroyed.Num()});
+#if WITH_UIDATASOURCE_MONITOR
+		FUIDatasourceMonitor& Monitor = UUIDatasourceSubsystem::Get()->Monitor;
+		if(Datasource->SubtreeObserverCount > 0)
+		{
+			Monitor.UpdateSubtreeObserverCounts(GetDatasourceById(Datasource->Parent), -Datasource->SubtreeObserverCount, &DeferredObservedChanges);
+		}
+		TArray<FUIDatasourceHandle, TInlineAllocator<64>> Handles;
+		Handles.Reserve(Destroyed.Num());
+		for(const FUIDatasource* Node : Destroyed)
+		{
+			Handles.Add(Node);
+		}
+		Monitor.PurgeDatasources(Handles, DeferredObservedChanges);
+#endif
 	}
 
-	UUIDatasourceSubsystem::LogDatasourceChange({Datasource});
-	Datasource->Id = EUIDatasourceId::Invalid;
-	Datasource->Generation++;
+	int32 LowestId = FirstFree;
+	for(FUIDatasource* Node : Destroyed)
+	{
+		if(const FUIDatasourceInternedString* InternedString = Node->Value.Value.TryGet<FUIDatasourceInternedString>())
+		{
+			Strings.Release(*InternedString);
+		}
+		if(EnumHasAllFlags(Node->Flags, EUIDatasourceFlag::HasChangePolicy))
+		{
+			ChangePolicies.Remove(Node->Id);
+		}
+		if(EnumHasAllFlags(Node->Flags, EUIDatasourceFlag::HashStructValues))
+		{
+			StructHashes.Remove(Node->Id);
+		}
+		if(EnumHasAllFlags(Node->Flags, EUIDatasourceFlag::IsAlias))
+		{
+			Aliases.Remove(Node->Id);
+		}
+		LowestId = FMath::Min(LowestId, static_cast<int32>(Node->Id));
+		
+		Node->BeginValueWrite();
+		Node->Id = EUIDatasourceId::Invalid;
+		Node->Generation++;
+		Node->EndValueWrite();
+	}
+	FirstFree = LowestId;
+	AllocatedCount -= Destroyed.Num();
 
-	// Patchup the linked list data
+	// Only the subtree root needs unlinking, links inside the subtree die with it
 	FUIDatasource* PrevSibling = GetDatasourceById(Datasource->PrevSibling);
 	FUIDatasource* NextSibling = GetDatasourceById(Datasource->NextSibling);
 	FUIDatasource* Parent = GetDatasourceById(Datasource->Parent);
@@ -331,6 +619,567 @@ void FUIDatasourcePool::DestroyDatasource(FUIDatasource* Datasource)
 	{
 		Parent->FirstChild = Datasource->NextSibling;
 	}
+
+	if(Parent != nullptr && !bIsStaging)
+	{
+		StampVersion(Parent);
+	}
+}
+
+FUIDatasource* FUIDatasourcePool::CloneSubtree(const FUIDatasource* Source, FUIDatasource* NewParent, FName NewName, EUIDatasourceCloneMode Mode)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	if(!Source || !NewParent || EnumHasAnyFlags(Source->Flags | NewParent->Flags, EUIDatasourceFlag::IsSink)
+		|| Source->Id == EUIDatasourceId::Root || Source->GetPool() != this || NewParent->GetPool() != this)
+	{
+		return nullptr;
+	}
+
+	if(EnumHasAllFlags(NewParent->Flags, EUIDatasourceFlag::IsAlias))
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Can't clone datasource %s under alias %s, aliases can't have children."), *Source->Name.ToString(), *NewParent->Name.ToString());
+		return nullptr;
+	}
+
+	if(NewName.IsNone())
+	{
+		NewName = Source->Name;
+	}
+	if(FindChildDatasource(NewParent, NewName))
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Can't clone datasource %s, %s already has a child named %s."), *Source->Name.ToString(), *NewParent->Name.ToString(), *NewName.ToString());
+		return nullptr;
+	}
+
+	// Gather the subtree in depth first order, parents always come before their children
+	TArray<const FUIDatasource*, TInlineAllocator<64>> Sources;
+	TArray<const FUIDatasource*, TInlineAllocator<64>> Stack;
+	Stack.Push(Source);
+	while(!Stack.IsEmpty())
+	{
+		const FUIDatasource* Current = Stack.Pop();
+		Sources.Add(Current);
+		for(const FUIDatasource* Child = GetDatasourceById(Current->FirstChild); Child; Child = GetDatasourceById(Child->NextSibling))
+		{
+			Stack.Push(Child);
+		}
+	}
+
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
+	TArray<FUIDatasource*> Clones;
+	if(!AllocateMany(Sources.Num(), Clones))
+	{
+		return nullptr;
+	}
+
+	TMap<EUIDatasourceId, EUIDatasourceId> Remap;
+	Remap.Reserve(Sources.Num());
+	for(int32 Idx = 0; Idx < Sources.Num(); ++Idx)
+	{
+		Remap.Add(Sources[Idx]->Id, Clones[Idx]->Id);
+	}
+	const auto RemapId = [&Remap](EUIDatasourceId Id) { const EUIDatasourceId* Mapped = Remap.Find(Id); return Mapped ? *Mapped : EUIDatasourceId::Invalid; };
+
+	// Bindings, providers and derivations belong to the source handles, clones start out as plain data
+	constexpr EUIDatasourceFlag CopiedFlags = EUIDatasourceFlag::IsArray | EUIDatasourceFlag::HashStructValues | EUIDatasourceFlag::HasChangePolicy | EUIDatasourceFlag::IsAlias;
+	const uint64 CloneVersion = ++Version;
+	for(int32 Idx = 0; Idx < Sources.Num(); ++Idx)
+	{
+		const FUIDatasource& From = *Sources[Idx];
+		FUIDatasource* Clone = Clones[Idx];
+		Clone->BeginValueWrite();
+		Clone->Name = From.Name;
+		Clone->Flags = From.Flags & CopiedFlags;
+		Clone->Parent = RemapId(From.Parent);
+		Clone->FirstChild = RemapId(From.FirstChild);
+		Clone->NextSibling = RemapId(From.NextSibling);
+		Clone->PrevSibling = RemapId(From.PrevSibling);
+		if(const FUIDatasourceInternedString* InternedString = From.Value.Value.TryGet<FUIDatasourceInternedString>())
+		{
+			Strings.AddRef(*InternedString);
+			Clone->Value = From.Value;
+		}
+		else if(const FString* String = Mode == EUIDatasourceCloneMode::ShareStrings ? From.Value.Value.TryGet<FString>() : nullptr)
+		{
+			Clone->Value.Value.Set<FUIDatasourceInternedString>(Strings.Intern(*String));
+		}
+		else
+		{
+			Clone->Value = From.Value; // FText, FName and images already share their payload
+		}
+		Clone->ValueVersion = CloneVersion;
+		Clone->SubtreeVersion = CloneVersion;
+		if(const FUIDatasourceChangePolicy* Policy = FindChangePolicy(&From))
+		{
+			ChangePolicies.Add(Clone->Id, *Policy);
+		}
+		SetStructHash(Clone, FindStructHash(&From));
+		if(const FUIDatasourceHandle* AliasTarget = EnumHasAllFlags(From.Flags, EUIDatasourceFlag::IsAlias) ? Aliases.Find(From.Id) : nullptr)
+		{
+			Aliases.Add(Clone->Id, *AliasTarget);
+		}
+		Clone->EndValueWrite();
+	}
+
+	// The clone of Source is a sibling of nothing yet, link it at the front of NewParent
+	FUIDatasource* Root = Clones[0];
+	Root->Name = NewName;
+	if(FUIDatasource* FirstChild = GetDatasourceById(NewParent->FirstChild))
+	{
+		FirstChild->PrevSibling = Root->Id;
+	}
+	Root->Parent = NewParent->Id;
+	Root->PrevSibling = EUIDatasourceId::Invalid;
+	Root->NextSibling = NewParent->FirstChild;
+	NewParent->FirstChild = Root->Id;
+
+	if(!bIsStaging)
+	{
+		UUIDatasourceSubsystem::LogDatasourceChange({Root});
+		StampVersion(Root);
+#if WITH_UIDATASOURCE_MONITOR
+		// Pattern subscriptions match individual datasources, every clone is newly attached
+		for(const FUIDatasource* Clone : Clones)
+		{
+			UUIDatasourceSubsystem::Get()->Monitor.OnDatasourceAttached(Clone);
+		}
+#endif
+	}
+	return Root;
+}
+
+bool FUIDatasourcePool::Reparent(FUIDatasource* Datasource, FUIDatasource* NewParent, FName NewName)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	if(!Datasource || !NewParent || EnumHasAnyFlags(Datasource->Flags | NewParent->Flags, EUIDatasourceFlag::IsSink)
+		|| Datasource->Id == EUIDatasourceId::Root || Datasource->GetPool() != this || NewParent->GetPool() != this)
+	{
+		return false;
+	}
+
+	for(const FUIDatasource* It = NewParent; It; It = GetDatasourceById(It->Parent))
+	{
+		if(It == Datasource)
+		{
+			UE_LOG(LogDatasource, Warning, TEXT("Can't move datasource %s under itself."), *Datasource->Name.ToString());
+			return false;
+		}
+	}
+
+	if(EnumHasAllFlags(NewParent->Flags, EUIDatasourceFlag::IsAlias))
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Can't move datasource %s under alias %s, aliases can't have children."), *Datasource->Name.ToString(), *NewParent->Name.ToString());
+		return false;
+	}
+
+	if(NewName.IsNone())
+	{
+		NewName = Datasource->Name;
+	}
+	if(NewParent->Id == Datasource->Parent && NewName == Datasource->Name)
+	{
+		return true;
+	}
+	const FUIDatasource* ExistingChild = FindChildDatasource(NewParent, NewName);
+	if(ExistingChild && ExistingChild != Datasource)
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Can't move datasource %s, %s already has a child named %s."), *Datasource->Name.ToString(), *NewParent->Name.ToString(), *NewName.ToString());
+		return false;
+	}
+
+	FUIDatasource* OldParent = GetDatasourceById(Datasource->Parent);
+#if WITH_UIDATASOURCE_MONITOR
+	FUIDatasourceMonitor* Monitor = !bIsStaging && Datasource->SubtreeObserverCount > 0 ? &UUIDatasourceSubsystem::Get()->Monitor : nullptr;
+	if(Monitor)
+	{
+		Monitor->UpdateSubtreeObserverCounts(OldParent, -Datasource->SubtreeObserverCount);
+	}
+#endif
+	
+	{
+		FUIDatasourceStructureWriteScope StructureWrite(*this);
+		FUIDatasource* PrevSibling = GetDatasourceById(Datasource->PrevSibling);
+		FUIDatasource* NextSibling = GetDatasourceById(Datasource->NextSibling);
+		if(PrevSibling != nullptr)
+		{
+			PrevSibling->NextSibling = Datasource->NextSibling;
+		}
+		else if(OldParent != nullptr)
+		{
+			OldParent->FirstChild = Datasource->NextSibling;
+		}
+		if(NextSibling != nullptr)
+		{
+			NextSibling->PrevSibling = Datasource->PrevSibling;
+		}
+
+		if(FUIDatasource* FirstChild = GetDatasourceById(NewParent->FirstChild))
+		{
+			FirstChild->PrevSibling = Datasource->Id;
+		}
+		Datasource->Name = NewName;
+		Datasource->Parent = NewParent->Id;
+		Datasource->PrevSibling = EUIDatasourceId::Invalid;
+		Datasource->NextSibling = NewParent->FirstChild;
+		NewParent->FirstChild = Datasource->Id;
+	}
+
+#if WITH_UIDATASOURCE_MONITOR
+	if(Monitor)
+	{
+		Monitor->UpdateSubtreeObserverCounts(NewParent, Datasource->SubtreeObserverCount);
+	}
+#endif
+	
+	if(bIsStaging)
+	{
+		return true;
+	}
+	
+	UUIDatasourceSubsystem::LogDatasourceChange({Datasource});
+	if(OldParent)
+	{
+		StampVersion(OldParent);
+	}
+	StampVersion(Datasource);
+#if WITH_UIDATASOURCE_MONITOR
+	UUIDatasourceSubsystem::Get()->Monitor.QueueDatasourceEvent({ EUIDatasourceChangeEventKind::Reparented, Datasource });
+#else
+	Datasource->OnDatasourceChanged.Broadcast({ EUIDatasourceChangeEventKind::Reparented, Datasource });
+	Datasource->OnDatasourceChangedNative.Broadcast({ EUIDatasourceChangeEventKind::Reparented, Datasource });
+#endif
+	return true;
+}
+
+bool FUIDatasourcePool::HasChangedSince(FUIDatasourceHandle Handle, uint64 SinceVersion, bool bIncludeChildren) const
+{
+	FUIDatasourceGeneration Generation;
+	EUIDatasourceId Id;
+	UIDatasource_UnpackId(Handle.Id, Generation, Id);
+	const FUIDatasource* Datasource = GetDatasourceById(Id);
+	if(!Datasource || Datasource->Generation != Generation)
+	{
+		return true;
+	}
+	return (bIncludeChildren ? Datasource->SubtreeVersion : Datasource->ValueVersion) > SinceVersion;
+}
+
+void FUIDatasourcePool::StampVersion(const FUIDatasource* Datasource)
+{
+	const uint64 NewVersion = ++Version;
+	FUIDatasource* Node = GetDatasourceById(Datasource->Id);
+	Node->ValueVersion = NewVersion;
+	for(; Node; Node = GetDatasourceById(Node->Parent))
+	{
+		Node->SubtreeVersion = NewVersion;
+	}
+}
+
+template<typename T>
+static int32 SetNumbers_Internal(FUIDatasourcePool& Pool, TConstArrayView<FUIDatasourceHandle> Handles, TConstArrayView<T> Values)
+{
+	UIDATASOURCE_FUNC_TRACE()
+
+	if(!ensureMsgf(Handles.Num() == Values.Num(), TEXT("Batch set expects as many values as handles (%d handles, %d values)."), Handles.Num(), Values.Num()))
+	{
+		return 0;
+	}
+
+	// Values are diffed and written in a single pass, notifications are batched afterward. Stale handles and sinks are skipped.
+	TArray<FUIDatasource*, TInlineAllocator<256>> Changed;
+	for(int32 Index = 0; Index < Handles.Num(); ++Index)
+	{
+		FUIDatasourceGeneration Generation;
+		EUIDatasourceId Id;
+		UIDatasource_UnpackId(Handles[Index].Id, Generation, Id);
+		FUIDatasource* Datasource = Pool.GetDatasourceById(Id);
+		if(!Datasource || Datasource->Generation != Generation || EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::IsSink))
+		{
+			continue;
+		}
+
+		T* CurrentValue = Datasource->Value.Value.TryGet<T>();
+		if(!CurrentValue)
+		{
+			Datasource->Set<T>(Values[Index]); // First write of a void datasource (or a mistyped one, which warns), not worth batching
+			continue;
+		}
+
+		// Bit for bit, a NaN compares unequal to itself and would be reported as changed on every batch
+		if(FMemory::Memcmp(CurrentValue, &Values[Index], sizeof(T)) == 0)
+		{
+			continue;
+		}
+		
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			if(EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::HasChangePolicy) && !Datasource->PassesChangePolicy(Values[Index]))
+			{
+				continue;
+			}
+		}
+
+		Datasource->BeginValueWrite();
+		*CurrentValue = Values[Index];
+		Datasource->EndValueWrite();
+		Changed.Add(Datasource);
+	}
+
+	if(Pool.IsStaging() || Changed.IsEmpty())
+	{
+		return Changed.Num();
+	}
+
+#if WITH_UIDATASOURCE_MONITOR
+	TArray<FUIDatasourceChangeEventArgs, TInlineAllocator<256>> Events;
+	Events.Reserve(Changed.Num());
+	for(FUIDatasource* Datasource : Changed)
+	{
+		Pool.StampVersion(Datasource);
+		Events.Add({ EUIDatasourceChangeEventKind::ValueSet, Datasource });
+	}
+	UUIDatasourceSubsystem::Get()->Monitor.QueueDatasourceEvents(Events);
+#else
+	for(const FUIDatasource* Datasource : Changed)
+	{
+		Datasource->OnValueChanged();
+	}
+#endif
+	return Changed.Num();
+}
+
+void FUIDatasourcePool::SetChangePolicy(FUIDatasource* Datasource, const FUIDatasourceChangePolicy& Policy)
+{
+	if(!Datasource || EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return;
+	}
+	
+	if(Policy.Mode == EUIDatasourceChangePolicyMode::None)
+	{
+		ChangePolicies.Remove(Datasource->Id);
+		EnumRemoveFlags(Datasource->Flags, EUIDatasourceFlag::HasChangePolicy);
+	}
+	else
+	{
+		ChangePolicies.Add(Datasource->Id, Policy);
+		EnumAddFlags(Datasource->Flags, EUIDatasourceFlag::HasChangePolicy);
+	}
+}
+
+const FUIDatasourceChangePolicy* FUIDatasourcePool::FindChangePolicy(const FUIDatasource* Datasource) const
+{
+	return Datasource && EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::HasChangePolicy) ? ChangePolicies.Find(Datasource->Id) : nullptr;
+}
+
+uint64 FUIDatasourcePool::FindStructHash(const FUIDatasource* Datasource) const
+{
+	const uint64* Hash = Datasource && EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::HashStructValues) ? StructHashes.Find(Datasource->Id) : nullptr;
+	return Hash ? *Hash : 0;
+}
+
+void FUIDatasourcePool::SetStructHash(const FUIDatasource* Datasource, uint64 Hash)
+{
+	if(!Datasource || !EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::HashStructValues))
+	{
+		return;
+	}
+
+	if(Hash == 0)
+	{
+		StructHashes.Remove(Datasource->Id);
+	}
+	else
+	{
+		StructHashes.Add(Datasource->Id, Hash);
+	}
+}
+
+bool FUIDatasourcePool::SetAlias(FUIDatasource* Alias, FUIDatasource* Target)
+{
+	if(!Alias || EnumHasAllFlags(Alias->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return false;
+	}
+	
+	if(!ensureMsgf(!bIsStaging, TEXT("Aliases can't be setup in a staging pool, handles don't survive the commit."))
+		|| !ensureMsgf(Alias->FirstChild == EUIDatasourceId::Invalid, TEXT("Alias datasource can't have children of its own.")))
+	{
+		return false;
+	}
+
+	if(Target)
+	{
+		const FUIDatasource* ResolvedTarget = ResolveAlias(Target);
+		if(ResolvedTarget == Alias || ResolvedTarget == nullptr)
+		{
+			UE_LOG(LogDatasource, Warning, TEXT("Can't alias datasource %s, its target is dangling or refers back to it."), *Alias->Name.ToString());
+			return false;
+		}
+	}
+
+	{
+		// Concurrent path lookups stop at aliases on their flag, it only changes inside a structure write like any link
+		FUIDatasourceStructureWriteScope StructureWrite(*this);
+		if(!Target)
+		{
+			Aliases.Remove(Alias->Id);
+			EnumRemoveFlags(Alias->Flags, EUIDatasourceFlag::IsAlias);
+		}
+		else
+		{
+			Aliases.Add(Alias->Id, Target);
+			EnumAddFlags(Alias->Flags, EUIDatasourceFlag::IsAlias);
+		}
+	}
+
+	UUIDatasourceSubsystem::LogDatasourceChange({Alias});
+	StampVersion(Alias);
+	return true;
+}
+
+FUIDatasource* FUIDatasourcePool::ResolveAlias(const FUIDatasource* Datasource) const
+{
+	for(int32 Hops = 0; Datasource && EnumHasAllFlags(Datasource->Flags, EUIDatasourceFlag::IsAlias); ++Hops)
+	{
+		const FUIDatasourceHandle* Target = Aliases.Find(Datasource->Id);
+		if(!Target || Hops >= MaxAliasHops)
+		{
+			return nullptr;
+		}
+		
+		FUIDatasourceGeneration Generation;
+		EUIDatasourceId Id;
+		UIDatasource_UnpackId(Target->Id, Generation, Id);
+		Datasource = GetDatasourceById(Id);
+		if(Datasource && Datasource->Generation != Generation)
+		{
+			Datasource = nullptr;
+		}
+	}
+	
+	// @NOTE: const_cast here as the pool owns the datasource memory, same as FindDatasource
+	return const_cast<FUIDatasource*>(Datasource);
+}
+
+int32 FUIDatasourcePool::SetFloats(TConstArrayView<FUIDatasourceHandle> Handles, TConstArrayView<float> Values) { return SetNumbers_Internal(*this, Handles, Values); }
+int32 FUIDatasourcePool::SetInts(TConstArrayView<FUIDatasourceHandle> Handles, TConstArrayView<int32> Values) { return SetNumbers_Internal(*this, Handles, Values); }
+
+FUIDatasource* FUIDatasourcePool::CommitStaging(FUIDatasourcePool& Staging, FUIDatasource* Parent, FName Name)
+{
+	UIDATASOURCE_FUNC_TRACE();
+
+	checkf(!bIsStaging && Staging.IsStaging(), TEXT("CommitStaging expects to move a staging pool into a regular pool."));
+
+	// Gather the staged subtree in depth first order, the staging root itself maps onto the target
+	const FUIDatasource* StagingRoot = Staging.GetRootDatasource();
+	TArray<const FUIDatasource*> StagedDatasources;
+	TArray<const FUIDatasource*> Stack;
+	for(const FUIDatasource* Child = Staging.GetDatasourceById(StagingRoot->FirstChild); Child; Child = Staging.GetDatasourceById(Child->NextSibling))
+	{
+		Stack.Push(Child);
+	}
+	while(!Stack.IsEmpty())
+	{
+		const FUIDatasource* Current = Stack.Pop();
+		StagedDatasources.Add(Current);
+		for(const FUIDatasource* Child = Staging.GetDatasourceById(Current->FirstChild); Child; Child = Staging.GetDatasourceById(Child->NextSibling))
+		{
+			Stack.Push(Child);
+		}
+	}
+
+	FUIDatasource* Target = FindOrCreateChildDatasource(Parent, Name);
+	if(!Target || EnumHasAllFlags(Target->Flags, EUIDatasourceFlag::IsSink))
+	{
+		return nullptr;
+	}
+
+	// @NOTE: Conservative check, doesn't account for the children of Target we're about to destroy, but we don't want to leave it half built
+	if(Capacity() - Num() < StagedDatasources.Num())
+	{
+		UE_LOG(LogDatasource, Error, TEXT("Not enough room to commit %d staged datasources, consider cleaning unused Datasource or increase pool size."), StagedDatasources.Num());
+		return nullptr;
+	}
+
+	FUIDatasourceStructureWriteScope StructureWrite(*this);
+	while(FUIDatasource* Child = GetDatasourceById(Target->FirstChild))
+	{
+		DestroyDatasource(Child);
+	}
+
+	// First pass allocates everything so we know all the final ids, second pass copies the content and fix up the links
+	TArray<EUIDatasourceId> Remap;
+	Remap.SetNumZeroed(Staging.Datasources.Num());
+	Remap[ToIndex(EUIDatasourceId::Root)] = Target->Id;
+	TArray<FUIDatasource*> Allocated;
+	Allocated.Reserve(StagedDatasources.Num());
+	for(const FUIDatasource* Staged : StagedDatasources)
+	{
+		FUIDatasource* NewDatasource = Allocate();
+		Remap[ToIndex(Staged->Id)] = NewDatasource->Id;
+		Allocated.Add(NewDatasource);
+	}
+
+	const uint64 CommitVersion = ++Version; // Staging versions are local to the staging pool, Target gets stamped on top of it below
+	for(int32 Idx = 0; Idx < StagedDatasources.Num(); ++Idx)
+	{
+		FUIDatasource& Staged = Staging.Datasources[ToIndex(StagedDatasources[Idx]->Id)];
+		FUIDatasource* NewDatasource = Allocated[Idx];
+		NewDatasource->BeginValueWrite();
+		NewDatasource->Name = Staged.Name;
+		NewDatasource->Flags = Staged.Flags;
+		NewDatasource->Parent = Remap[ToIndex(Staged.Parent)];
+		NewDatasource->FirstChild = Remap[ToIndex(Staged.FirstChild)];
+		NewDatasource->NextSibling = Remap[ToIndex(Staged.NextSibling)];
+		NewDatasource->PrevSibling = Remap[ToIndex(Staged.PrevSibling)];
+		NewDatasource->Value = MoveTemp(Staged.Value);
+		NewDatasource->ValueVersion = CommitVersion;
+		NewDatasource->SubtreeVersion = CommitVersion;
+		if(const FUIDatasourceChangePolicy* Policy = Staging.FindChangePolicy(&Staged))
+		{
+			ChangePolicies.Add(NewDatasource->Id, *Policy);
+		}
+		SetStructHash(NewDatasource, Staging.FindStructHash(&Staged));
+		if(FUIDatasourceInternedString* InternedString = NewDatasource->Value.Value.TryGet<FUIDatasourceInternedString>())
+		{
+			*InternedString = Strings.Intern(Staging.Strings.Resolve(*InternedString)); // Staging table is dropped wholesale below
+		}
+		NewDatasource->EndValueWrite();
+	}
+
+	FUIDatasource& StagedRoot = Staging.Datasources[ToIndex(EUIDatasourceId::Root)];
+	const FUIDatasourceInternedString* PreviousString = Target->Value.Value.TryGet<FUIDatasourceInternedString>();
+	Strings.Release(PreviousString ? *PreviousString : FUIDatasourceInternedString());
+	Target->BeginValueWrite();
+	Target->FirstChild = Remap[ToIndex(StagedRoot.FirstChild)];
+	Target->Flags |= StagedRoot.Flags;
+	Target->Value = MoveTemp(StagedRoot.Value);
+	SetStructHash(Target, Staging.FindStructHash(&StagedRoot));
+	if(const FUIDatasourceChangePolicy* Policy = Staging.FindChangePolicy(&StagedRoot))
+	{
+		ChangePolicies.Add(Target->Id, *Policy);
+	}
+	if(FUIDatasourceInternedString* InternedString = Target->Value.Value.TryGet<FUIDatasourceInternedString>())
+	{
+		*InternedString = Strings.Intern(Staging.Strings.Resolve(*InternedString));
+	}
+	Target->EndValueWrite();
+	
+	Staging.Clear();
+
+	UUIDatasourceSubsystem::LogDatasourceChange({Target});
+	Target->OnValueChanged();
+#if WITH_UIDATASOURCE_MONITOR
+	// Pattern subscriptions match individual datasources, every committed one is newly attached
+	for(const FUIDatasource* NewDatasource : Allocated)
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.OnDatasourceAttached(NewDatasource);
+	}
+#endif
+	return Target;
 }
 
 UUIDatasourceSubsystem* UUIDatasourceSubsystem::Instance = nullptr;
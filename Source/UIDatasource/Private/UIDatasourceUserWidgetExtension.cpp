@@ -4,6 +4,9 @@
 
 #include "UIDatasourceSubsystem.h"
 #include "Blueprint/UserWidget.h"
+#include "Components/SlateWrapperTypes.h"
+#include "Components/TextBlock.h"
+#include "UObject/UnrealType.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UIDatasourceUserWidgetExtension)
 
@@ -22,6 +25,364 @@ void UUIDatasourceUserWidgetExtension::AddBinding(const FUIDataBind& Binding)
 	Linker.AddBinding(Binding);
 }
 
+void UUIDatasourceUserWidgetExtension::AddFormatBinding(const FUIDataFormatBindTemplate& Template, const FTextFormat& Format)
+{
+	UUIDatasourceTextFormatter* Formatter = NewObject<UUIDatasourceTextFormatter>(this);
+	Formatter->Setup(GetUserWidget(), Template, Format);
+	Formatters.Add(Formatter);
+
+	FOnDatasourceChangedDelegateBP Delegate;
+	Delegate.BindUFunction(Formatter, GET_FUNCTION_NAME_CHECKED(UUIDatasourceTextFormatter, OnInputChanged));
+	for(const FString& Argument : Template.Arguments)
+	{
+		AddBinding({
+			Delegate,
+			Argument,
+			Template.BindType,
+		});
+	}
+}
+
+void UUIDatasourceUserWidgetExtension::AddPropertyBinding(const FUIDataPropertyBindTemplate& Template)
+{
+	const TSharedRef<FUIDatasourcePropertyBinder> Binder = MakeShared<FUIDatasourcePropertyBinder>(GetUserWidget(), Template);
+	PropertyBinders.Add(Binder);
+	
+	FUIDataBind Binding = { {}, Template.Path, Template.BindType };
+	Binding.NativeBind = FOnDatasourceChangedNative::FDelegate::CreateSP(Binder, &FUIDatasourcePropertyBinder::OnDatasourceChanged);
+	AddBinding(Binding);
+}
+
+namespace UIDatasourcePropertyBinder
+{
+	static bool GetNumber(const FUIDatasource& Source, double& OutValue)
+	{
+		const FUIDatasourceValue::FValueType& Value = Source.Value.Value;
+		if(const int32* Int = Value.TryGet<int32>())		{ OutValue = *Int; return true; }
+		if(const float* Float = Value.TryGet<float>())		{ OutValue = *Float; return true; }
+		if(const double* Double = Value.TryGet<double>())	{ OutValue = *Double; return true; }
+		if(const int64* Int64 = Value.TryGet<int64>())		{ OutValue = static_cast<double>(*Int64); return true; }
+		return false;
+	}
+
+	static bool IsVisibilityProperty(const FProperty* Property)
+	{
+		const UEnum* VisibilityEnum = StaticEnum<ESlateVisibility>();
+		if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return EnumProperty->GetEnum() == VisibilityEnum;
+		}
+		const FByteProperty* ByteProperty = CastField<FByteProperty>(Property);
+		return ByteProperty && ByteProperty->Enum == VisibilityEnum;
+	}
+	
+	template<typename T>
+	static bool CopyValue(const FUIDatasource& Source, void* OutValue)
+	{
+		const T* Value = Source.Value.Value.TryGet<T>();
+		if(Value)
+		{
+			*static_cast<T*>(OutValue) = *Value;
+		}
+		return Value != nullptr;
+	}
+	
+	static bool ConvertDirect(const FUIDatasource& Source, const FProperty* Property, void* OutValue)
+	{
+		if(Property->IsA<FIntProperty>())		return CopyValue<int32>(Source, OutValue);
+		if(Property->IsA<FFloatProperty>())		return CopyValue<float>(Source, OutValue);
+		if(Property->IsA<FDoubleProperty>())	return CopyValue<double>(Source, OutValue);
+		if(Property->IsA<FInt64Property>())		return CopyValue<int64>(Source, OutValue);
+		if(Property->IsA<FTextProperty>())		return CopyValue<FText>(Source, OutValue);
+		if(Property->IsA<FNameProperty>())		return CopyValue<FName>(Source, OutValue);
+		if(Property->IsA<FStrProperty>())		return Source.TryGetString(*static_cast<FString*>(OutValue));
+		if(const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+		{
+			const bool* Bool = Source.Value.Value.TryGet<bool>();
+			if(Bool)
+			{
+				BoolProperty->SetPropertyValue(OutValue, *Bool); // Might be a bitfield
+			}
+			return Bool != nullptr;
+		}
+		if(const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if(StructProperty->Struct == TBaseStructure<FLinearColor>::Get())	return CopyValue<FLinearColor>(Source, OutValue);
+			if(StructProperty->Struct == TBaseStructure<FVector2D>::Get())		return CopyValue<FVector2D>(Source, OutValue);
+			if(StructProperty->Struct == FGameplayTag::StaticStruct())			return CopyValue<FGameplayTag>(Source, OutValue);
+		}
+		return false;
+	}
+
+	static bool ConvertVisibility(const FUIDatasource& Source, const FProperty* Property, void* OutValue, bool bInverted)
+	{
+		const bool* Bool = Source.Value.Value.TryGet<bool>();
+		if(!Bool)
+		{
+			return false;
+		}
+		
+		const ESlateVisibility Visibility = *Bool != bInverted ? ESlateVisibility::Visible : ESlateVisibility::Collapsed;
+		if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(OutValue, static_cast<int64>(Visibility));
+		}
+		else
+		{
+			*static_cast<uint8*>(OutValue) = static_cast<uint8>(Visibility);
+		}
+		return true;
+	}
+
+	static bool ConvertBoolToVisibility(const FUIDatasource& Source, const FProperty* Property, void* OutValue)
+	{
+		return ConvertVisibility(Source, Property, OutValue, false);
+	}
+
+	static bool ConvertBoolToVisibilityInverted(const FUIDatasource& Source, const FProperty* Property, void* OutValue)
+	{
+		return ConvertVisibility(Source, Property, OutValue, true);
+	}
+
+	static bool ConvertFloatToProgress(const FUIDatasource& Source, const FProperty* Property, void* OutValue)
+	{
+		double Number;
+		if(!GetNumber(Source, Number))
+		{
+			return false;
+		}
+		*static_cast<float*>(OutValue) = FMath::Clamp(static_cast<float>(Number), 0.0f, 1.0f);
+		return true;
+	}
+
+	static bool ConvertNumberToText(const FUIDatasource& Source, const FProperty* Property, void* OutValue)
+	{
+		const FUIDatasourceValue::FValueType& Value = Source.Value.Value;
+		FText& Text = *static_cast<FText*>(OutValue);
+		if(const int32* Int = Value.TryGet<int32>())		{ Text = FText::AsNumber(*Int); return true; }
+		if(const int64* Int64 = Value.TryGet<int64>())		{ Text = FText::AsNumber(*Int64); return true; }
+		if(const float* Float = Value.TryGet<float>())		{ Text = FText::AsNumber(*Float); return true; }
+		if(const double* Double = Value.TryGet<double>())	{ Text = FText::AsNumber(*Double); return true; }
+		return false;
+	}
+}
+
+FUIDatasourcePropertyBinder::FUIDatasourcePropertyBinder(UUserWidget* InUserWidget, const FUIDataPropertyBindTemplate& Template)
+	: UserWidget(InUserWidget)
+	, WidgetName(Template.WidgetName)
+	, PropertyName(Template.PropertyName)
+	, Conversion(Template.Conversion)
+	, Converter(GetConverter(Template.Conversion))
+{
+}
+
+FUIDatasourcePropertyBinder::~FUIDatasourcePropertyBinder()
+{
+	if(ValueBuffer)
+	{
+		Property->DestroyValue(ValueBuffer);
+		FMemory::Free(ValueBuffer);
+	}
+}
+
+bool FUIDatasourcePropertyBinder::IsCompatible(const FProperty* InProperty, EUIDatasourcePropertyConversion InConversion)
+{
+	switch(InConversion)
+	{
+	case EUIDatasourcePropertyConversion::Direct:
+		if(const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+		{
+			return StructProperty->Struct == TBaseStructure<FLinearColor>::Get() || StructProperty->Struct == TBaseStructure<FVector2D>::Get() || StructProperty->Struct == FGameplayTag::StaticStruct();
+		}
+		return InProperty->IsA<FIntProperty>() || InProperty->IsA<FFloatProperty>() || InProperty->IsA<FDoubleProperty>() || InProperty->IsA<FInt64Property>()
+			|| InProperty->IsA<FBoolProperty>() || InProperty->IsA<FTextProperty>() || InProperty->IsA<FNameProperty>() || InProperty->IsA<FStrProperty>();
+	case EUIDatasourcePropertyConversion::BoolToVisibility:
+	case EUIDatasourcePropertyConversion::BoolToVisibilityInverted:
+		return UIDatasourcePropertyBinder::IsVisibilityProperty(InProperty);
+	case EUIDatasourcePropertyConversion::FloatToProgress:
+		return InProperty->IsA<FFloatProperty>();
+	case EUIDatasourcePropertyConversion::NumberToText:
+		return InProperty->IsA<FTextProperty>();
+	default:
+		return false;
+	}
+}
+
+FUIDatasourcePropertyBinder::FConverter FUIDatasourcePropertyBinder::GetConverter(EUIDatasourcePropertyConversion InConversion)
+{
+	switch(InConversion)
+	{
+	case EUIDatasourcePropertyConversion::Direct:					return &UIDatasourcePropertyBinder::ConvertDirect;
+	case EUIDatasourcePropertyConversion::BoolToVisibility:			return &UIDatasourcePropertyBinder::ConvertBoolToVisibility;
+	case EUIDatasourcePropertyConversion::BoolToVisibilityInverted:	return &UIDatasourcePropertyBinder::ConvertBoolToVisibilityInverted;
+	case EUIDatasourcePropertyConversion::FloatToProgress:			return &UIDatasourcePropertyBinder::ConvertFloatToProgress;
+	case EUIDatasourcePropertyConversion::NumberToText:				return &UIDatasourcePropertyBinder::ConvertNumberToText;
+	default:														return nullptr;
+	}
+}
+
+bool FUIDatasourcePropertyBinder::ResolveProperty()
+{
+	if(Widget.IsValid() && Property)
+	{
+		return true;
+	}
+
+	UUserWidget* OwnerWidget = UserWidget.Get();
+	UWidget* TargetWidget = OwnerWidget ? OwnerWidget->GetWidgetFromName(WidgetName) : nullptr;
+	if(!TargetWidget || !Converter)
+	{
+		return false;
+	}
+
+	const FProperty* TargetProperty = FindFProperty<FProperty>(TargetWidget->GetClass(), PropertyName);
+	if(!TargetProperty || !IsCompatible(TargetProperty, Conversion))
+	{
+		UE_LOG(LogDatasource, Warning, TEXT("Property binding %s.%s doesn't match a compatible property, binding ignored."), *WidgetName.ToString(), *PropertyName.ToString());
+		return false;
+	}
+
+	Widget = TargetWidget;
+	if(Property != TargetProperty)
+	{
+		check(!ValueBuffer);
+		Property = TargetProperty;
+		ValueBuffer = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+		Property->InitializeValue(ValueBuffer);
+	}
+	return true;
+}
+
+void FUIDatasourcePropertyBinder::OnDatasourceChanged(const FUIDatasourceChangeEventArgs& EventArgs)
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	const FUIDatasource* Source = EventArgs.Handle.Get();
+	if(!Source || !ResolveProperty())
+	{
+		return;
+	}
+
+	UWidget* TargetWidget = Widget.Get();
+	if(Converter(*Source, Property, ValueBuffer))
+	{
+		if(Property->HasSetter())
+		{
+			Property->CallSetter(TargetWidget, ValueBuffer); // Native setters also push the value to the underlying slate widget
+		}
+		else
+		{
+			Property->SetValue_InContainer(TargetWidget, ValueBuffer);
+			TargetWidget->SynchronizeProperties();
+		}
+	}
+}
+
+static FFormatArgumentValue UIDatasource_ToFormatArgument(const FUIDatasource& Datasource)
+{
+	const FUIDatasourceValue::FValueType& Value = Datasource.Value.Value;
+	if(const int32* Int = Value.TryGet<int32>())				return FFormatArgumentValue(*Int);
+	if(const float* Float = Value.TryGet<float>())				return FFormatArgumentValue(*Float);
+	if(const double* Double = Value.TryGet<double>())			return FFormatArgumentValue(*Double);
+	if(const int64* Int64 = Value.TryGet<int64>())				return FFormatArgumentValue(*Int64);
+	if(const FText* Text = Value.TryGet<FText>())				return FFormatArgumentValue(*Text);
+	if(const FName* Name = Value.TryGet<FName>())				return FFormatArgumentValue(FText::FromName(*Name));
+	if(const FGameplayTag* Tag = Value.TryGet<FGameplayTag>())	return FFormatArgumentValue(FText::FromName(Tag->GetTagName()));
+	if(const bool* Bool = Value.TryGet<bool>())					return FFormatArgumentValue(FText::AsCultureInvariant(LexToString(*Bool)));
+
+	FString String;
+	if(Datasource.TryGetString(String))
+	{
+		return FFormatArgumentValue(FText::FromString(MoveTemp(String)));
+	}
+	return FFormatArgumentValue(FText::GetEmpty());
+}
+
+void UUIDatasourceTextFormatter::Setup(UUserWidget* InUserWidget, const FUIDataFormatBindTemplate& Template, const FTextFormat& InFormat)
+{
+	UserWidget = InUserWidget;
+	TextBlockName = Template.TextBlockName;
+	Format = InFormat;
+	ArgumentPaths = Template.Arguments;
+	BindType = Template.BindType;
+	for(const FString& Argument : ArgumentPaths)
+	{
+		Arguments.Add(Argument, FText::GetEmpty()); // Unresolved inputs format as empty rather than leaving {Argument} in the text
+	}
+}
+
+void UUIDatasourceTextFormatter::OnInputChanged(FUIDatasourceChangeEventArgs EventArgs)
+{
+	ChangedInputs.AddUnique(EventArgs.Handle);
+#if WITH_UIDATASOURCE_MONITOR
+	if(!bPending)
+	{
+		bPending = true;
+		UUIDatasourceSubsystem::Get()->Monitor.PendingFormatters.Add(this);
+	}
+#else
+	Flush();
+#endif
+}
+
+void UUIDatasourceTextFormatter::Flush()
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	bPending = false;
+	UUserWidget* Widget = UserWidget.Get();
+	UTextBlock* Target = TextBlock.Get();
+	if(!Target && Widget)
+	{
+		Target = Cast<UTextBlock>(Widget->GetWidgetFromName(TextBlockName));
+		TextBlock = Target;
+	}
+	
+	const UUIDatasourceUserWidgetExtension* Extension = Widget ? Widget->GetExtension<UUIDatasourceUserWidgetExtension>() : nullptr;
+	const FUIDatasource* Scope = BindType == EDatasourceBindType::Self && Extension ? Extension->GetDatasource().Get() : nullptr;
+	if(!Target || (BindType == EDatasourceBindType::Self && !Scope))
+	{
+		ChangedInputs.Reset();
+		return;
+	}
+
+	const FUIDatasourcePool& Pool = UUIDatasourceSubsystem::Get()->Pool;
+	const int32 StructureSequence = Pool.ReadStructureSequence();
+	if(ResolvedStructureSequence != StructureSequence || ResolvedScope != FUIDatasourceHandle(Scope))
+	{
+		ResolvedStructureSequence = StructureSequence;
+		ResolvedScope = Scope;
+		ArgumentHandles.Reset();
+		for(const FString& Path : ArgumentPaths)
+		{
+			ArgumentHandles.Add(Pool.FindDatasource(Scope, Path));
+		}
+	}
+
+	bool bAnyArgumentChanged = false;
+	for(int32 Index = 0; Index < ArgumentPaths.Num(); ++Index)
+	{
+		const FUIDatasource* Input = ChangedInputs.Contains(ArgumentHandles[Index]) ? ArgumentHandles[Index].Get() : nullptr;
+		if(Input)
+		{
+			Arguments.Add(ArgumentPaths[Index], UIDatasource_ToFormatArgument(*Input));
+			bAnyArgumentChanged = true;
+		}
+	}
+	ChangedInputs.Reset();
+
+	if(bAnyArgumentChanged)
+	{
+		Target->SetText(FText::Format(Format, Arguments));
+	}
+}
+
+void UUIDatasourceTextFormatter::CancelPending()
+{
+	bPending = false;
+	ChangedInputs.Reset();
+}
+
 void UUIDatasourceUserWidgetExtension::Construct()
 {
 	Linker.LinkGlobalBindings(true);
@@ -36,6 +397,23 @@ void UUIDatasourceUserWidgetExtension::Destruct()
 void UUIDatasourceWidgetBlueprintGeneratedClassExtension::Initialize(UUserWidget* UserWidget)
 {
 	UUIDatasourceUserWidgetExtension* DatasourceExtension = UUIDatasourceUserWidgetExtension::RegisterDatasourceExtension(UserWidget);
+	if(CompiledFormats.Num() != FormatBindings.Num())
+	{
+		CompiledFormats.Reset(FormatBindings.Num());
+		for(const FUIDataFormatBindTemplate& FormatBinding : FormatBindings)
+		{
+			CompiledFormats.Add(FTextFormat(FormatBinding.Format));
+		}
+	}
+	for(int32 Index = 0; Index < FormatBindings.Num(); ++Index)
+	{
+		DatasourceExtension->AddFormatBinding(FormatBindings[Index], CompiledFormats[Index]);
+	}
+	for(const FUIDataPropertyBindTemplate& PropertyBinding : PropertyBindings)
+	{
+		DatasourceExtension->AddPropertyBinding(PropertyBinding);
+	}
+	
 	for (FUIDataBindTemplate& Binding : Bindings)
 	{
 		UFunction* Func = UserWidget->FindFunction(Binding.BindDelegateName);
@@ -67,7 +445,11 @@ void UUIDatasourceWidgetBlueprintGeneratedClassExtension::PreConstruct(UUserWidg
 		TArray<FUIDatasourceDescriptor> Descriptors;
 		for(FUIDataBindTemplate& Binding : Bindings)
 		{
-			Descriptors.Add(Binding.Descriptor);
+			FUIDatasourceDescriptor& Descriptor = Descriptors.Add_GetRef(Binding.Descriptor);
+			FStringView Path;
+			FName Field;
+			FUIDatasourceLink::SplitFieldPath(Descriptor.Path, Path, Field);
+			Descriptor.Path = FString(Path); // Mock the datasource holding the struct, not the field
 		}
 		Archetype->SetChildren(Descriptors);
 		Archetype->MockDatasource(MockDatasource);
@@ -77,6 +459,112 @@ void UUIDatasourceWidgetBlueprintGeneratedClassExtension::PreConstruct(UUserWidg
 }
 #endif
 
+static void BindDatasource(FUIDatasource* Datasource, const FUIDataBind& Binding)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	if(Binding.NativeBind.IsBound())
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceNativeEvent(Datasource, Binding.NativeBind);
+	}
+	else if(Binding.bIsSubtree)
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceSubtreeEvent(Datasource, Binding.Bind);
+	}
+	else if(Binding.Field.IsNone())
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceEvent(Datasource, Binding.Bind);
+	}
+	else
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceFieldEvent(Datasource, Binding.Field, Binding.Bind);
+	}
+#else
+	if(Binding.NativeBind.IsBound())
+	{
+		Datasource->OnDatasourceChangedNative.Add(Binding.NativeBind);
+	}
+	else
+	{
+		Datasource->OnDatasourceChanged.AddUnique(Binding.Bind); // Field and subtree bindings need the monitor, bind on the datasource value instead
+	}
+#endif
+	
+	// ReSharper disable once CppExpressionWithoutSideEffects
+	Binding.Bind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Datasource, Binding.Field });
+	// ReSharper disable once CppExpressionWithoutSideEffects
+	Binding.NativeBind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Datasource, Binding.Field });
+}
+
+static void UnbindDatasource(FUIDatasource* Datasource, const FUIDataBind& Binding)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	if(Binding.NativeBind.IsBound())
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceNativeEvent(Datasource, Binding.NativeBind.GetHandle());
+	}
+	else if(Binding.bIsSubtree)
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceSubtreeEvent(Datasource, Binding.Bind);
+	}
+	else if(Binding.Field.IsNone())
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceEvent(Datasource, Binding.Bind);
+	}
+	else
+	{
+		UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceFieldEvent(Datasource, Binding.Field, Binding.Bind);
+	}
+#else
+	if(Binding.NativeBind.IsBound())
+	{
+		Datasource->OnDatasourceChangedNative.Remove(Binding.NativeBind.GetHandle());
+	}
+	else
+	{
+		Datasource->OnDatasourceChanged.Remove(Binding.Bind);
+	}
+#endif
+}
+
+static void BindDatasourcePattern(FUIDatasource* Scope, const FUIDataBind& Binding)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	UUIDatasourceSubsystem::Get()->Monitor.BindDatasourcePatternEvent(Scope, Binding.Path, Binding.Bind);
+
+	TArray<FUIDatasource*> Matches;
+	FUIDatasourceMonitor::GatherPatternMatches(Scope, Binding.Path, Matches);
+	for(FUIDatasource* Match : Matches)
+	{
+		// ReSharper disable once CppExpressionWithoutSideEffects
+		Binding.Bind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Match });
+	}
+#else
+	UE_LOG(LogDatasource, Warning, TEXT("Pattern binding %s requires WITH_UIDATASOURCE_MONITOR, ignoring."), *Binding.Path);
+#endif
+}
+
+static void UnbindDatasourcePattern(FUIDatasource* Scope, const FUIDataBind& Binding)
+{
+#if WITH_UIDATASOURCE_MONITOR
+	UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourcePatternEvent(Scope, Binding.Path, Binding.Bind);
+#endif
+}
+
+void FUIDatasourceLink::SplitFieldPath(FStringView BindingPath, FStringView& OutPath, FName& OutField)
+{
+	int32 ColonPos;
+	if(BindingPath.FindChar(TEXT(':'), ColonPos))
+	{
+		OutPath = BindingPath.Left(ColonPos);
+		OutField = FName(BindingPath.RightChop(ColonPos + 1));
+	}
+	else
+	{
+		OutPath = BindingPath;
+		OutField = NAME_None;
+	}
+}
+
 void FUIDatasourceLink::UpdateBindings(FUIDatasourceHandle OldHandle, FUIDatasourceHandle NewHandle)
 {
 	const FUIDatasourcePool& DatasourcePool = UUIDatasourceSubsystem::Get()->Pool;
@@ -84,13 +572,13 @@ void FUIDatasourceLink::UpdateBindings(FUIDatasourceHandle OldHandle, FUIDatasou
 	{
 		for(auto& Bind: Bindings)
 		{
-			if(FUIDatasource* Datasource = DatasourcePool.FindDatasource(OldDatasource, Bind.Path))
+			if(Bind.bIsPattern)
 			{
-#if WITH_UIDATASOURCE_MONITOR
-				UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceEvent(Datasource, Bind.Bind);
-#else
-				Datasource->OnDatasourceChanged.Remove(Bind.Bind);
-#endif
+				UnbindDatasourcePattern(const_cast<FUIDatasource*>(OldDatasource), Bind);
+			}
+			else if(FUIDatasource* Datasource = DatasourcePool.FindDatasource(OldDatasource, Bind.Path))
+			{
+				UnbindDatasource(Datasource, Bind);
 			}
 		}
 	}
@@ -99,38 +587,48 @@ void FUIDatasourceLink::UpdateBindings(FUIDatasourceHandle OldHandle, FUIDatasou
 	{
 		for(const FUIDataBind& Bind : Bindings)
 		{
-			if(FUIDatasource* Datasource = DatasourcePool.FindDatasource(NewDatasource, Bind.Path))
+			if(Bind.bIsPattern)
 			{
-#if WITH_UIDATASOURCE_MONITOR
-				UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceEvent(Datasource, Bind.Bind);
-#else
-				Datasource->OnDatasourceChanged.Add(Bind.Bind);
-#endif
-				
-				// ReSharper disable once CppExpressionWithoutSideEffects
-				Bind.Bind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Datasource });
+				BindDatasourcePattern(const_cast<FUIDatasource*>(NewDatasource), Bind);
+			}
+			else if(FUIDatasource* Datasource = DatasourcePool.FindDatasource(NewDatasource, Bind.Path))
+			{
+				BindDatasource(Datasource, Bind);
 			}
 		}
 	}
 }
 
-void FUIDatasourceLink::AddBinding(const FUIDataBind& Binding)
+void FUIDatasourceLink::AddBinding(const FUIDataBind& InBinding)
 {
+	FUIDataBind Binding = InBinding;
+	if(Binding.Field.IsNone())
+	{
+		FStringView Path;
+		SplitFieldPath(InBinding.Path, Path, Binding.Field);
+		Binding.Path = FString(Path);
+	}
+	if(Binding.Path.EndsWith(TEXT("...")))
+	{
+		Binding.bIsSubtree = true;
+		Binding.Path.LeftChopInline(3);
+		Binding.Path.RemoveFromEnd(TEXT("."));
+	}
+	Binding.bIsPattern = Binding.Path.Contains(TEXT("*"));
+	ensureMsgf(!Binding.bIsPattern || !Binding.NativeBind.IsBound(), TEXT("Pattern binding %s can't be native, it'd only ever target a single datasource."), *Binding.Path);
+	
 	if(Binding.BindType == EDatasourceBindType::Self)
 	{
 		Bindings.Add(Binding);
 		if(const FUIDatasource* OwnDatasource = Handle.Get())
 		{
-			if(FUIDatasource* Datasource = UUIDatasourceSubsystem::Get()->Pool.FindDatasource(OwnDatasource, Binding.Path))
+			if(Binding.bIsPattern)
 			{
-#if WITH_UIDATASOURCE_MONITOR
-				UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceEvent(Datasource, Binding.Bind);
-#else
-				Datasource->OnDatasourceChanged.AddUnique(Binding.Bind);
-#endif
-				
-				// ReSharper disable once CppExpressionWithoutSideEffects
-				Binding.Bind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Datasource });
+				BindDatasourcePattern(const_cast<FUIDatasource*>(OwnDatasource), Binding);
+			}
+			else if(FUIDatasource* Datasource = UUIDatasourceSubsystem::Get()->Pool.FindDatasource(OwnDatasource, Binding.Path))
+			{
+				BindDatasource(Datasource, Binding);
 			}
 		}
 	}
@@ -147,26 +645,27 @@ void FUIDatasourceLink::LinkGlobalBindings(bool bLink)
 	// Resolve any global bindings here
 	for (FUIDataBind& Binding : GlobalBindings)
 	{
-		if(FUIDatasource* Datasource = UUIDatasourceSubsystem::Get()->Pool.FindOrCreateDatasource(nullptr, Binding.Path))
+		if(Binding.bIsPattern)
 		{
+			FUIDatasource* Root = UUIDatasourceSubsystem::Get()->Pool.GetRootDatasource();
 			if(bLink)
 			{
-#if WITH_UIDATASOURCE_MONITOR
-				UUIDatasourceSubsystem::Get()->Monitor.BindDatasourceEvent(Datasource, Binding.Bind);
-#else
-				Datasource->OnDatasourceChanged.Add(Binding.Bind);
-#endif
-
-				// ReSharper disable once CppExpressionWithoutSideEffects
-				Binding.Bind.ExecuteIfBound({ EUIDatasourceChangeEventKind::InitialBind, Datasource });
+				BindDatasourcePattern(Root, Binding);
 			}
 			else
 			{
-#if WITH_UIDATASOURCE_MONITOR
-				UUIDatasourceSubsystem::Get()->Monitor.UnbindDatasourceEvent(Datasource, Binding.Bind);
-#else
-				Datasource->OnDatasourceChanged.Remove(Binding.Bind);
-#endif
+				UnbindDatasourcePattern(Root, Binding);
+			}
+		}
+		else if(FUIDatasource* Datasource = UUIDatasourceSubsystem::Get()->Pool.FindOrCreateDatasource(nullptr, Binding.Path))
+		{
+			if(bLink)
+			{
+				BindDatasource(Datasource, Binding);
+			}
+			else
+			{
+				UnbindDatasource(Datasource, Binding);
 			}
 		}
 	}
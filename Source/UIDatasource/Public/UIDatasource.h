@@ -6,10 +6,13 @@
 #include "InstancedStruct.h"
 #include "UIDatasourceDefines.h"
 #include "UIDatasourceHandle.h"
+#include "UIDatasourceStringTable.h"
 #include "Engine/Texture2D.h"
 #include "Materials/MaterialInterface.h"
 #include "Templates/IsTriviallyCopyConstructible.h"
 
+#include <concepts>
+
 #include "UIDatasource.generated.h"
 
 struct FUIDatasourcePool;
@@ -31,6 +34,10 @@ enum class EUIDatasourceValueType : uint8
 	Image,
 	GameplayTag,
 	Struct, // FInstancedStruct
+	Vector2D,
+	LinearColor,
+	Int64,
+	Double,
 	Archetype, // @NOTE: This is for archetype UX purposes, devolves to Void at runtime
 };
 
@@ -57,10 +64,94 @@ struct FUIDatasourceImage
 	bool operator==(const FUIDatasourceImage& Other) const { return Image == Other.Image; }
 };
 
+// Default value returned by failed gets, math types (FVector2D, FLinearColor) need ForceInit to not be left uninitialized
+template<typename T>
+T UIDatasource_DefaultValue()
+{
+	if constexpr (std::is_class_v<T> && std::is_constructible_v<T, EForceInit>)
+	{
+		return T(ForceInit);
+	}
+	else
+	{
+		return T{};
+	}
+}
+
+UENUM(BlueprintType)
+enum class EUIDatasourceChangePolicyMode : uint8
+{
+	None, // Any difference is a change
+	AbsoluteEpsilon, // Changes smaller than Epsilon are dropped
+	RelativeEpsilon, // Changes smaller than Epsilon times the magnitude of the value are dropped
+	Quantize, // Only changes crossing one of the Steps subdivisions of [RangeMin, RangeMax] go through
+};
+
+// Per datasource filter of float and double writes, lets smoothed values (regen, cooldown progress...) only notify
+// when the change is actually visible. Suppressed writes are dropped entirely, the stored value stays the last notified one.
+USTRUCT(BlueprintType)
+struct UIDATASOURCE_API FUIDatasourceChangePolicy
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EUIDatasourceChangePolicyMode Mode = EUIDatasourceChangePolicyMode::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, EditConditionHides, EditCondition="Mode==EUIDatasourceChangePolicyMode::AbsoluteEpsilon || Mode==EUIDatasourceChangePolicyMode::RelativeEpsilon"))
+	float Epsilon = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin=1, EditConditionHides, EditCondition="Mode==EUIDatasourceChangePolicyMode::Quantize"))
+	int32 Steps = 100;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditConditionHides, EditCondition="Mode==EUIDatasourceChangePolicyMode::Quantize"))
+	float RangeMin = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditConditionHides, EditCondition="Mode==EUIDatasourceChangePolicyMode::Quantize"))
+	float RangeMax = 1.0f;
+
+	bool IsSignificantChange(double OldValue, double NewValue) const;
+};
+
+UENUM(BlueprintType)
+enum class EUIDatasourceRateLimitMode : uint8
+{
+	None,
+	Throttle, // At most MaxEventsPerSecond events, changes in between are coalesced and delivered on the trailing edge
+	Debounce, // Delivered once the value stopped changing for DebounceDelay, or after MaxDebounceDelay at the latest
+};
+
+// Per datasource event rate limit enforced by FUIDatasourceMonitor, for values changing every tick (ping, fps, distances...).
+// Only delays value change events, the latest value is always delivered eventually.
+USTRUCT(BlueprintType)
+struct FUIDatasourceRateLimit
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EUIDatasourceRateLimitMode Mode = EUIDatasourceRateLimitMode::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0.1, EditConditionHides, EditCondition="Mode==EUIDatasourceRateLimitMode::Throttle"))
+	float MaxEventsPerSecond = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, EditConditionHides, EditCondition="Mode==EUIDatasourceRateLimitMode::Debounce"))
+	float DebounceDelay = 0.25f;
+
+	// Upper bound on how long a constantly changing value can be held back, 0 to wait for it to settle no matter what
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(ClampMin=0, EditConditionHides, EditCondition="Mode==EUIDatasourceRateLimitMode::Debounce"))
+	float MaxDebounceDelay = 1.0f;
+};
+
+// Values we can compare against a stored T without having to construct a T first
+template<typename T, typename OtherType>
+concept CUIDatasourceComparableWith = !std::is_same_v<FText, T> && requires(const T& Lhs, const std::decay_t<OtherType>& Rhs)
+{
+	{ Lhs == Rhs } -> std::convertible_to<bool>;
+};
+
 struct FUIDatasourceValue
 {
 	struct FVoidType {};
-	using FValueType = TVariant<FVoidType, int32, float, bool, FName, FText, FString, FUIDatasourceImage, FGameplayTag, FInstancedStruct>;
+	using FValueType = TVariant<FVoidType, int32, float, bool, FName, FText, FString, FUIDatasourceImage, FGameplayTag, FInstancedStruct, FUIDatasourceInternedString, FVector2D, FLinearColor, int64, double>;
 
 	FValueType Value;
 
@@ -77,18 +168,23 @@ struct FUIDatasourceValue
 		if(Value.IsType<FName>())		return EUIDatasourceValueType::Name;
 		if(Value.IsType<FText>())		return EUIDatasourceValueType::Text;
 		if(Value.IsType<FString>())		return EUIDatasourceValueType::String;
+		if(Value.IsType<FUIDatasourceInternedString>()) return EUIDatasourceValueType::String; // Interned strings are strings for all UX purposes
 		if(Value.IsType<FUIDatasourceImage>()) return EUIDatasourceValueType::Image;
 		if(Value.IsType<FGameplayTag>()) return EUIDatasourceValueType::GameplayTag;
 		if(Value.IsType<FInstancedStruct>()) return EUIDatasourceValueType::Struct;
+		if(Value.IsType<FVector2D>())	return EUIDatasourceValueType::Vector2D;
+		if(Value.IsType<FLinearColor>()) return EUIDatasourceValueType::LinearColor;
+		if(Value.IsType<int64>())		return EUIDatasourceValueType::Int64;
+		if(Value.IsType<double>())		return EUIDatasourceValueType::Double;
 		return EUIDatasourceValueType::Void;
 	}
 	
-	template<typename T>
-	bool ValueEqual(const T& Val) const
+	template<typename T, typename OtherType = T>
+	bool ValueEqual(const OtherType& Val) const
 	{
 		UIDATASOURCE_FUNC_TRACE()
 
-		if constexpr (std::is_same<FText, T>())
+		if constexpr (std::is_same<FText, T>() && std::is_same<FText, OtherType>())
 		{
 			return Value.Get<T>().IdenticalTo(Val);
 		}
@@ -100,17 +196,75 @@ struct FUIDatasourceValue
 
 	template<typename T>
 	bool Set(const T& NewValue)
+	{
+		return SetInternal<T>(NewValue);
+	}
+
+	template<typename T> requires (!std::is_reference_v<T>)
+	bool Set(T&& NewValue)
+	{
+		return SetInternal<T>(MoveTemp(NewValue));
+	}
+
+	// Construct the value in place, if Args is a single value directly comparable with T (e.g. a TCHAR* for an FString)
+	// we compare before constructing anything, so redundant writes don't allocate
+	template<typename T, typename... ArgTypes>
+	bool Emplace(ArgTypes&&... Args)
+	{
+		UIDATASOURCE_FUNC_TRACE()
+		
+		static_assert(!std::is_same<FVoidType, T>(), "Cannot set value to FVoidType, use Clear instead.");
+		static_assert(FValueType::IndexOfType<T>() != static_cast<SIZE_T>(-1), "Tried to set datasource to invalid type.");
+
+		if(T* CurrentValue = Value.TryGet<T>())
+		{
+			if constexpr (sizeof...(ArgTypes) == 1 && (CUIDatasourceComparableWith<T, ArgTypes> && ...))
+			{
+				if((ValueEqual<T>(Args) && ...))
+				{
+					return false;
+				}
+
+				if constexpr ((std::is_assignable_v<T&, ArgTypes&&> && ...))
+				{
+					((*CurrentValue = Forward<ArgTypes>(Args)), ...);
+				}
+				else
+				{
+					*CurrentValue = T(Forward<ArgTypes>(Args)...);
+				}
+				return true;
+			}
+			else
+			{
+				return SetInternal<T>(T(Forward<ArgTypes>(Args)...));
+			}
+		}
+
+		if(Value.IsType<FVoidType>())
+		{
+			Value.Emplace<T>(Forward<ArgTypes>(Args)...);
+			return true;
+		}
+		
+		UE_LOG(LogDatasource, Warning, TEXT("Tried to assign a value of incompatible type in datasource value (Found %llu, Expected %llu)"), FValueType::IndexOfType<T>(), Value.GetIndex());
+		return false;
+	}
+
+	template<typename T, typename ValueType>
+	bool SetInternal(ValueType&& NewValue)
 	{
 		UIDATASOURCE_FUNC_TRACE()
 
 		static_assert(!std::is_same<FVoidType, T>(), "Cannot set value to FVoidType, use Clear instead.");
 		static_assert(FValueType::IndexOfType<T>() != static_cast<SIZE_T>(-1), "Tried to set datasource to invalid type.");
 
-		if(Value.IsType<T>())
+		if(T* CurrentValue = Value.TryGet<T>())
 		{
 			if(!ValueEqual<T>(NewValue))
 			{
-				Value.Set<T>(NewValue);
+				// @NOTE: Assign in place rather than re-constructing the variant, lets FString & co reuse their existing allocation
+				*CurrentValue = Forward<ValueType>(NewValue);
 				return true;
 			}
 			return false;
@@ -118,7 +272,7 @@ struct FUIDatasourceValue
 		
 		if(Value.IsType<FVoidType>())
 		{
-			Value.Set<T>(NewValue);
+			Value.Set<T>(Forward<ValueType>(NewValue));
 			return true;
 		}
 		
@@ -139,7 +293,7 @@ struct FUIDatasourceValue
 		}
 
 		UE_LOG(LogDatasource, Warning, TEXT("Tried to get a value of incompatible type (Found %llu, Expected %llu), returning default"), FValueType::IndexOfType<T>(), Value.GetIndex());
-		return {};
+		return UIDatasource_DefaultValue<T>();
 	}
 
 	template<typename T>
@@ -155,7 +309,7 @@ struct FUIDatasourceValue
 		}
 
 		UE_LOG(LogDatasource, Warning, TEXT("Tried to get a value of incompatible type (Found %llu, Expected %llu), returning default"), FValueType::IndexOfType<T>(), Value.GetIndex());
-		static T StaticObjectInstance = T {}; // this allows us to return an "invalid" ref
+		static T StaticObjectInstance = UIDatasource_DefaultValue<T>(); // this allows us to return an "invalid" ref
 		return StaticObjectInstance;
 	}
 	
@@ -184,6 +338,11 @@ enum class EUIDatasourceFlag : uint8
 	None      = 0,
 	IsSink = 1 << 0, // Sink datasource returns themselves when querying children, no-op on Set, and return default values on Get 
 	IsArray   = 1 << 1,
+	HashStructValues = 1 << 2, // FInstancedStruct values are compared through a content hash instead of a full reflected compare
+	HasFieldBindings = 1 << 3, // Some bindings observe fields of the FInstancedStruct value, struct writes are diffed per field
+	HasChangePolicy = 1 << 4, // Float and double writes go through a FUIDatasourceChangePolicy, see FUIDatasourcePool::SetChangePolicy
+	IsProvider = 1 << 5, // Value is computed on demand by a provider callback, see FUIDatasourceMonitor::SetProvider
+	IsAlias = 1 << 6, // Path resolution continues on another datasource, see FUIDatasourcePool::SetAlias
 };
 ENUM_CLASS_FLAGS(EUIDatasourceFlag)
 
@@ -192,6 +351,10 @@ enum class EUIDatasourceChangeEventKind : uint8
 {
 	InitialBind,
 	ValueSet,
+	FieldSet, // A bound field of a struct value changed, see FUIDatasourceChangeEventArgs::Field
+	Attached, // A datasource matching a pattern subscription got created, only sent to pattern subscriptions
+	Reparented, // The datasource (and its subtree) moved under another parent or got renamed, see FUIDatasourcePool::Reparent
+	SubtreeChanged, // Something under the datasource changed this flush, only sent to subtree subscriptions (see FUIDatasourceMonitor::GetDirtyDescendants)
 };
 
 USTRUCT(BlueprintType)
@@ -205,15 +368,35 @@ struct FUIDatasourceChangeEventArgs
 	UPROPERTY(BlueprintReadOnly)
 	FUIDatasourceHandle Handle = {};
 
+	// Property path inside the struct value for field bindings (e.g. Armor.Value for a binding on Stats:Armor.Value), None otherwise
+	UPROPERTY(BlueprintReadOnly)
+	FName Field = {};
+
 	bool operator==(const FUIDatasourceChangeEventArgs& Other) const
 	{
-		return Kind == Other.Kind && Handle == Other.Handle;
+		return Kind == Other.Kind && Handle == Other.Handle && Field == Other.Field;
 	}
 };
 static_assert(TIsTriviallyCopyConstructible<FUIDatasourceChangeEventArgs>::Value, "FUIDatasourceChangeEventArgs should be trivially constructible for fast copy");
 
+inline uint32 GetTypeHash(const FUIDatasourceChangeEventArgs& Event)
+{
+	return HashCombineFast(HashCombineFast(GetTypeHash(static_cast<uint8>(Event.Kind)), GetTypeHash(Event.Handle)), GetTypeHash(Event.Field));
+}
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDatasourceChangedDelegate, FUIDatasourceChangeEventArgs, EventArgs);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnDatasourceChangedDelegateBP, FUIDatasourceChangeEventArgs, EventArgs);
+// Native counterpart of FOnDatasourceChangedDelegate, doesn't go through ProcessEvent
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDatasourceChangedNative, const FUIDatasourceChangeEventArgs&);
+
+// Fields that couldn't be read by FUIDatasource::ReadIntoStruct, as dot separated paths from the read datasource
+struct FUIDatasourceStructReadResult
+{
+	TArray<FString> MissingFields;
+	TArray<FString> MistypedFields;
+
+	bool IsComplete() const { return MissingFields.IsEmpty() && MistypedFields.IsEmpty(); }
+};
 
 struct UIDATASOURCE_API FUIDatasource
 {
@@ -228,15 +411,52 @@ struct UIDATASOURCE_API FUIDatasource
 	EUIDatasourceId PrevSibling;
 
 	EUIDatasourceFlag Flags;
+
+	// Sequence counter guarding Value for concurrent readers, odd while the game thread is writing to it (see FUIDatasourcePool::TryGetConcurrent)
+	int32 ValueSequence;
 	FUIDatasourceValue Value;
 
+	// Pool version of the last change of the value, and of the last change of the value or structure of anything under this datasource (itself included)
+	// see FUIDatasourcePool::HasChangedSince
+	uint64 ValueVersion;
+	uint64 SubtreeVersion;
+
+#if WITH_UIDATASOURCE_MONITOR
+	// Last monitor flush that bubbled a change through this datasource, see FUIDatasourceMonitor::MarkSubtreeDirty
+	uint32 SubtreeEpoch;
+	// Delegates bound to this datasource, and to this datasource or anything under it, maintained by the monitor bind calls
+	int32 ObserverCount;
+	int32 SubtreeObserverCount;
+#endif
+
 #if !WITH_UIDATASOURCE_MONITOR
 	FOnDatasourceChangedDelegate OnDatasourceChanged;
+	FOnDatasourceChangedNative OnDatasourceChangedNative;
 #endif
 
 	FUIDatasourcePool* GetPool() const;
 
+	// Whether anything listens to this datasource, producers can skip computing display data nobody sees.
+	// Without the monitor, counts only tell whether the datasource delegates are bound and don't include children.
+	bool IsObserved() const { return GetObserverCount() > 0; }
+	int32 GetObserverCount() const;
+	bool IsSubtreeObserved() const { return GetSubtreeObserverCount() > 0; }
+	int32 GetSubtreeObserverCount() const;
+
 	void OnValueChanged() const;
+	// Diff bound fields of the current struct value against NewValue, only called if HasFieldBindings is set
+	void OnStructValueChanging(const FInstancedStruct& NewValue) const;
+	// Run NewValue through the change policy of this datasource, only called if HasChangePolicy is set
+	bool PassesChangePolicy(double NewValue) const;
+	// Bring the value of a provider datasource up to date before reading it, no-op for regular datasources
+	void Pull()
+	{
+		if(UNLIKELY(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsProvider)))
+		{
+			PullProvider();
+		}
+	}
+	void PullProvider();
 
 	FUIDatasource* FindOrCreateFromPath(FWideStringView Path);
 	FUIDatasource* FindOrCreateFromPath(FAnsiStringView Path);
@@ -244,21 +464,193 @@ struct UIDATASOURCE_API FUIDatasource
 	FUIDatasource* FindFromPath(FAnsiStringView Path) const;
 
 	void GetPath(FString& OutPath);
+
+	// Store the string in the pool string table instead of its own FString, equality becomes an index compare
+	// and the string memory is shared with every other datasource holding the same value
+	bool SetInterned(FStringView InValue);
+	FStringView GetInterned() const;
 	
+	// String accessors that work on both FString and interned string values, keeps the existing value representation on set
+	bool SetString(FString InValue);
+	bool TryGetString(FString& OutValue) const;
+
+	// Write every supported property of the struct in a child datasource of the same name, nested structs become subtrees and TArray
+	// members array datasources. The property to datasource mapping is cached per struct type, and only differing values are notified.
+	void SetFromStruct(const UScriptStruct* Struct, const void* StructData);
 	template<typename T>
-	bool Set(T InValue)
+	void SetFromStruct(const T& InStruct) { SetFromStruct(T::StaticStruct(), &InStruct); }
+
+	// Reverse of SetFromStruct using the same cached mapping, fills the struct in a single pass over the subtree.
+	// Missing or mistyped fields are left untouched and reported in OutResult, returns true if every field was read.
+	bool ReadIntoStruct(const UScriptStruct* Struct, void* StructData, FUIDatasourceStructReadResult* OutResult = nullptr) const;
+	template<typename T>
+	bool ReadIntoStruct(T& OutStruct, FUIDatasourceStructReadResult* OutResult = nullptr) const { return ReadIntoStruct(T::StaticStruct(), &OutStruct, OutResult); }
+	
+	// Interned strings are refcounted by the pool string table, they can only be written through SetInterned
+	template<typename T>
+	static constexpr bool CanSetDirectly = !std::is_same_v<FUIDatasourceInternedString, T>;
+
+	template<typename T>
+	bool Set(const T& InValue)
+	{
+		static_assert(CanSetDirectly<T>, "Use SetInterned to write interned strings.");
+		return SetInternal<T>(InValue);
+	}
+
+	template<typename T> requires (!std::is_reference_v<T>)
+	bool Set(T&& InValue)
+	{
+		static_assert(CanSetDirectly<T>, "Use SetInterned to write interned strings.");
+		return SetInternal<T>(MoveTemp(InValue));
+	}
+
+	// Construct the value in place, see FUIDatasourceValue::Emplace
+	template<typename T, typename... ArgTypes>
+	bool Emplace(ArgTypes&&... Args)
 	{
+		static_assert(CanSetDirectly<T>, "Use SetInterned to write interned strings.");
+		
 		if(UNLIKELY(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink)))
 		{
 			return false;
 		}
+
+		if constexpr (std::is_same_v<FString, T>)
+		{
+			if(Value.Value.IsType<FUIDatasourceInternedString>())
+			{
+				return SetInternal<FString>(FString(Forward<ArgTypes>(Args)...));
+			}
+		}
+
+		if constexpr (std::is_same_v<FInstancedStruct, T>)
+		{
+			if(EnumHasAnyFlags(Flags, EUIDatasourceFlag::HashStructValues | EUIDatasourceFlag::HasFieldBindings))
+			{
+				return SetInternal<FInstancedStruct>(FInstancedStruct(Forward<ArgTypes>(Args)...));
+			}
+		}
 		
-		if(Value.Set<T>(InValue))
+		BeginValueWrite();
+		const bool bChanged = Value.Emplace<T>(Forward<ArgTypes>(Args)...);
+		EndValueWrite();
+		
+		if(bChanged)
 		{
 			OnValueChanged();
-			return true;
 		}
-		return false;
+		return bChanged;
+	}
+
+	template<typename T, typename ValueType>
+	bool SetInternal(ValueType&& InValue)
+	{
+		if(UNLIKELY(EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink)))
+		{
+			return false;
+		}
+
+		if constexpr (std::is_same_v<FString, T>)
+		{
+			if(Value.Value.IsType<FUIDatasourceInternedString>())
+			{
+				return SetInterned(InValue); // Interned strings (e.g. ShareStrings clones) stay interned, same as SetString
+			}
+		}
+
+		if constexpr (std::is_same_v<FInstancedStruct, T>)
+		{
+			if(EnumHasAllFlags(Flags, EUIDatasourceFlag::HashStructValues))
+			{
+				return SetHashedStruct(Forward<ValueType>(InValue));
+			}
+		}
+		
+		if constexpr (std::is_same_v<FInstancedStruct, T>)
+		{
+			if(EnumHasAllFlags(Flags, EUIDatasourceFlag::HasFieldBindings))
+			{
+				OnStructValueChanging(InValue);
+			}
+		}
+
+		if constexpr (std::is_same_v<float, T> || std::is_same_v<double, T>)
+		{
+			if(EnumHasAllFlags(Flags, EUIDatasourceFlag::HasChangePolicy) && !PassesChangePolicy(static_cast<double>(InValue)))
+			{
+				return false;
+			}
+		}
+		
+		BeginValueWrite();
+		const bool bChanged = Value.SetInternal<T>(Forward<ValueType>(InValue));
+		EndValueWrite();
+		
+		if(bChanged)
+		{
+			OnValueChanged();
+		}
+		return bChanged;
+	}
+
+	template<typename ValueType>
+	bool SetHashedStruct(ValueType&& InValue)
+	{
+		UIDATASOURCE_FUNC_TRACE()
+		
+		uint64 NewHash = 0;
+		if(IsUnchangedHashedStruct(InValue, NewHash))
+		{
+			return false;
+		}
+		
+		FInstancedStruct* CurrentValue = Value.Value.TryGet<FInstancedStruct>();
+		if(!CurrentValue && !Value.Value.IsType<FUIDatasourceValue::FVoidType>())
+		{
+			UE_LOG(LogDatasource, Warning, TEXT("Tried to assign a value of incompatible type in datasource value (Found %llu, Expected %llu)"), FUIDatasourceValue::FValueType::IndexOfType<FInstancedStruct>(), Value.Value.GetIndex());
+			return false;
+		}
+
+		if(EnumHasAllFlags(Flags, EUIDatasourceFlag::HasFieldBindings))
+		{
+			OnStructValueChanging(InValue);
+		}
+		
+		BeginValueWrite();
+		if(CurrentValue)
+		{
+			*CurrentValue = Forward<ValueType>(InValue);
+		}
+		else
+		{
+			Value.Value.Set<FInstancedStruct>(Forward<ValueType>(InValue));
+		}
+		EndValueWrite();
+		StoreStructHash(NewHash);
+
+		OnValueChanged();
+		return true;
+	}
+
+	// Field wise xxHash of the value, floats normalized so values equal under compare hash the same and strings hashed on their exact
+	// characters. Returns false if a property can't be hashed exactly (maps, sets, soft references...).
+	static bool HashStructValue(const FInstancedStruct& InValue, uint64& OutHash);
+	// A hash matching the stored one is unchanged, no full compare. Structs that can't be hashed fall back on comparing the values.
+	bool IsUnchangedHashedStruct(const FInstancedStruct& NewValue, uint64& OutNewHash) const;
+	// Stored in a pool side table, see FUIDatasourcePool::FindStructHash
+	void StoreStructHash(uint64 Hash) const;
+
+	// Seqlock write window, only ever called from the game thread, readers retry if they observe an odd or changed sequence
+	void BeginValueWrite()
+	{
+		FPlatformAtomics::AtomicStore_Relaxed(&ValueSequence, ValueSequence + 1);
+		FPlatformMisc::MemoryBarrier();
+	}
+
+	void EndValueWrite()
+	{
+		FPlatformMisc::MemoryBarrier();
+		FPlatformAtomics::AtomicStore_Relaxed(&ValueSequence, ValueSequence + 1);
 	}
 
 	template<typename T>
@@ -270,13 +662,29 @@ struct UIDATASOURCE_API FUIDatasource
 	template<typename T>
 	T Get() const
 	{
-		return EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink) ? T{} : Value.Get<T>();
+		if constexpr (std::is_same_v<FString, T>)
+		{
+			if(Value.Value.IsType<FUIDatasourceInternedString>())
+			{
+				FString String;
+				TryGetString(String); // Leaves the string empty on sinks, same as the default value
+				return String;
+			}
+		}
+		return EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink) ? UIDatasource_DefaultValue<T>() : Value.Get<T>();
 	}
 
 	template<typename T>
 	bool TryGet(T& OutValue) const
 	{
-		return EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink) ? false : Value.TryGet<T>(OutValue);
+		if constexpr (std::is_same_v<FString, T>)
+		{
+			return TryGetString(OutValue); // Resolves interned strings too
+		}
+		else
+		{
+			return EnumHasAllFlags(Flags, EUIDatasourceFlag::IsSink) ? false : Value.TryGet<T>(OutValue);
+		}
 	}
 
 	FUIDatasource& operator[](FWideStringView Path);
@@ -293,6 +701,10 @@ struct UIDATASOURCE_API FUIArrayDatasource : FUIDatasource
 	int32 GetNum() const { return Get<int32>(); }
 	FUIDatasource* Append(); // Append a datasource to the end of the array
 	FUIDatasource* AppendFront(); // Append a datasource to the front of the array, reshuffle the IDs of subsequent elements
+	// Append Count datasources at once, reusing left over item datasources found in a single pass and creating the missing ones,
+	// fails without touching the array if the pool can't fit the missing items. Only accounts for the items themselves, callers
+	// building children under them must check for room first. OutItems receives the appended items in order.
+	bool AppendN(int32 Count, TArray<FUIDatasource*>* OutItems = nullptr);
 	void Empty(bool bDestroyChildren = false);
 	FUIDatasource* GetChildAt(int32 Index) const;
 
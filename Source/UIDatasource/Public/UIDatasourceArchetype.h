@@ -43,12 +43,24 @@ struct FUIDatasourceDescriptor
 	UPROPERTY(EditAnywhere, meta=(EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Image"))
 	EUIDatasourceImageType ImageType = EUIDatasourceImageType::Texture;
 	
+	// Compare struct values through a content hash, worth it for large structs set every frame
+	UPROPERTY(EditAnywhere, meta=(EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Struct"))
+	bool bHashStructValue = false;
+
+	// Filter applied to writes of this value, drops changes too small to be visible
+	UPROPERTY(EditAnywhere, meta=(EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Float || Type==EUIDatasourceValueType::Double"))
+	FUIDatasourceChangePolicy ChangePolicy;
+	
 	UPROPERTY(EditAnywhere, meta=(EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Archetype"))
 	TObjectPtr<UUIDatasourceArchetype> Archetype = nullptr;
 
 	UPROPERTY(EditAnywhere, meta=(EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Archetype"))
 	EUIDatasourceArchetypeImportMethod ImportMethod = EUIDatasourceArchetypeImportMethod::AsChild;
 
+	// Number of items the array is created with, each of them generated from Archetype
+	UPROPERTY(EditAnywhere, meta=(ClampMin=0, EditConditionHides, EditCondition="Type==EUIDatasourceValueType::Archetype && ImportMethod==EUIDatasourceArchetypeImportMethod::AsArray"))
+	int32 InitialCount = 0;
+
 #if WITH_EDITORONLY_DATA
 	// Semantic comment to help understand what the field expects to contain, unavailable in ship
 	UPROPERTY(EditAnywhere)
@@ -61,6 +73,63 @@ struct FUIDatasourceDescriptor
 	}
 };
 
+// A single datasource to create when instantiating an archetype layout
+USTRUCT()
+struct FUIDatasourceArchetypeLayoutNode
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName Name;
+
+	// Index of the parent node in the layout, 0 for datasources created directly under the instantiated datasource.
+	// Only node 0, the instantiated datasource itself, has INDEX_NONE.
+	UPROPERTY()
+	int32 Parent = INDEX_NONE;
+
+	// Runtime type of the default value (Enum resolves to Int, Archetype to Void)
+	UPROPERTY()
+	EUIDatasourceValueType Type = EUIDatasourceValueType::Void;
+
+	UPROPERTY()
+	bool bIsArray = false;
+
+	UPROPERTY()
+	bool bHashStructValue = false;
+
+	UPROPERTY()
+	FUIDatasourceChangePolicy ChangePolicy;
+	
+	// Item archetype of array nodes
+	UPROPERTY()
+	TObjectPtr<UUIDatasourceArchetype> ItemArchetype = nullptr;
+
+	UPROPERTY()
+	int32 InitialCount = 0;
+};
+
+// Archetype tree flattened into a list of pre-split names, parents always come before their children
+// so instantiation is a single loop without any path parsing nor recursion
+USTRUCT()
+struct FUIDatasourceArchetypeLayout
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FUIDatasourceArchetypeLayoutNode> Nodes;
+
+	UPROPERTY()
+	bool bIsCompiled = false;
+
+#if WITH_EDITOR
+	// Archetypes the layout was compiled from (itself and its inline / child imports) with their edit epoch at the time,
+	// the layout is stale as soon as one of them got edited, see UUIDatasourceArchetype::EditEpoch
+	TArray<TPair<TWeakObjectPtr<const UUIDatasourceArchetype>, uint32>> Dependencies;
+
+	bool IsUpToDate() const;
+#endif
+};
+
 UCLASS()
 class UIDATASOURCE_API UUIDatasourceArchetype : public UDataAsset
 {
@@ -68,6 +137,7 @@ class UIDATASOURCE_API UUIDatasourceArchetype : public UDataAsset
 
 public:
 	void MockDatasource(FUIDatasource* Datasource) const;
+	// Fails with an error without touching Datasource if the pool can't fit every node the layout instantiates
 	void GenerateDatasource(FUIDatasource* Datasource) const;
 	
 	UFUNCTION(BlueprintCallable)
@@ -80,6 +150,22 @@ public:
 
 	void SetChildren(const TArray<FUIDatasourceDescriptor>& Descriptors);
 
+	// Whether Archetype is this archetype or is imported by it, directly or transitively through any import method
+	bool ImportsArchetype(const UUIDatasourceArchetype* Archetype) const;
+
+	// Number of datasources a generation allocates at most, every layout node plus the InitialCount items of arrays and their own nodes
+	int32 GetInstanceNodeCount() const;
+
+	// Compiled layout used by GenerateDatasource, built on load and recompiled on the game thread whenever an archetype got edited
+	const FUIDatasourceArchetypeLayout& GetLayout() const;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	uint32 GetEditEpoch() const { return EditEpoch; }
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#endif
+
 	// Return a string list of all loaded enums in the engine, used to gather UEnum* in editor for K2Node purposes
 	UFUNCTION()
 	static TArray<FString> GetEnumChoices();
@@ -88,6 +174,21 @@ protected:
 	UPROPERTY(EditAnywhere, meta=(TitleProperty="Path"))
 	TArray<FUIDatasourceDescriptor> Children;
 
+	void CompileLayout(FUIDatasourceArchetypeLayout& OutLayout) const;
+	// Builds the layout under Datasource, callers already checked the pool can fit GetInstanceNodeCount() more datasources
+	void InstantiateLayout(FUIDatasource* Datasource) const;
+	// NodeLookup maps a (parent node, name) pair to its node so shared path segments are found without scanning the layout
+	void CompileLayout_Recursive(FUIDatasourceArchetypeLayout& OutLayout, int32 ParentNode, TArray<const UUIDatasourceArchetype*>& ArchetypeStack, TMap<TPair<int32, FName>, int32>& NodeLookup) const;
+
+	// Only serialized in cooked data, editor builds compile it on load
+	UPROPERTY()
+	mutable FUIDatasourceArchetypeLayout Layout;
+
+#if WITH_EDITOR
+	// Bumped on every edit of this archetype, layouts importing it compare it against the epoch they were compiled with
+	uint32 EditEpoch = 1;
+#endif
+
 	static TArray<FName> MockNameSource;
 	static TArray<FString> MockStringSource;
 	static TArray<FText> MockTextSource;
@@ -63,6 +63,40 @@ public:
 	UFUNCTION(BlueprintPure, Category=UIDatasource, DisplayName="Equal (Datasource)", meta=(CompactNodeTitle="==", Keywords="== equal"))
 	static bool EqualEqual_DatasourceHandle(FUIDatasourceHandle HandleA, FUIDatasourceHandle HandleB);
 	
+	// Limit how often change events of the datasource are delivered, the latest value is always delivered eventually. Mode None removes the limit.
+	UFUNCTION(BlueprintCallable, Category=UIDatasource)
+	static void SetDatasourceRateLimit(FUIDatasourceHandle Handle, FUIDatasourceRateLimit RateLimit);
+	
+	// Make the datasource derived from an arithmetic expression over sibling paths (e.g. Health / MaxHealth), recomputed whenever an input changes.
+	// Returns false if the expression doesn't compile.
+	UFUNCTION(BlueprintCallable, Category=UIDatasource)
+	static bool SetDatasourceExpression(FUIDatasourceHandle Handle, FString Expression);
+	
+	// Copy the datasource and everything under it as a new child of NewParent (e.g. a nameplate default layout), returns the copy
+	UFUNCTION(BlueprintCallable, Category=UIDatasource)
+	static FUIDatasourceHandle CloneDatasource(FUIDatasourceHandle Source, FUIDatasourceHandle NewParent, FName NewName, EUIDatasourceCloneMode Mode);
+	
+	// Move the datasource and everything under it to NewParent, renamed to NewName unless None. Handles and bindings stay valid.
+	UFUNCTION(BlueprintCallable, Category=UIDatasource)
+	static bool ReparentDatasource(FUIDatasourceHandle Handle, FUIDatasourceHandle NewParent, FName NewName);
+	
+	// Make Alias share the data of Target, paths going through Alias resolve to Target (e.g. Hotbar.Slot_0 -> Inventory.Items.Item_3).
+	// An invalid Target removes the alias. Returns false if Alias has children or if this would form a cycle.
+	UFUNCTION(BlueprintCallable, Category=UIDatasource)
+	static bool SetDatasourceAlias(FUIDatasourceHandle Alias, FUIDatasourceHandle Target);
+	
+	// Current datasource version, store it alongside what was read to later poll HasDatasourceChangedSince
+	UFUNCTION(BlueprintPure, Category=UIDatasource)
+	static int64 GetDatasourceVersion();
+
+	// Whether the datasource (or anything under it if bIncludeChildren) changed since Version, cheap enough to call every frame
+	UFUNCTION(BlueprintPure, Category=UIDatasource)
+	static bool HasDatasourceChangedSince(FUIDatasourceHandle Handle, int64 Version, bool bIncludeChildren = false);
+	
+	// Children of the datasource with changes under them, only valid while handling a SubtreeChanged event
+	UFUNCTION(BlueprintPure, Category=UIDatasource)
+	static TArray<FUIDatasourceHandle> GetSubtreeChanges(const FUIDatasourceChangeEventArgs& EventArgs);
+	
 	// Setup datasource to be an array
 	UFUNCTION(BlueprintCallable, Category=UIArrayDatasource, DisplayName="Make Array")
 	static FUIDatasourceHandle ArrayDatasource_MakeArray(FUIDatasourceHandle Handle);
@@ -112,6 +146,10 @@ public:
 	UFUNCTION(BlueprintPure, Category=UIDatasource) static TSoftObjectPtr<UMaterialInterface> GetMaterial(FUIDatasourceHandle Handle);
 	UFUNCTION(BlueprintPure, Category=UIDatasource) static FGameplayTag     GetGameplayTag(FUIDatasourceHandle Handle);
 	UFUNCTION(BlueprintPure, Category=UIDatasource) static FInstancedStruct GetStruct(FUIDatasourceHandle Handle);
+	UFUNCTION(BlueprintPure, Category=UIDatasource) static FVector2D	GetVector2D(FUIDatasourceHandle Handle);
+	UFUNCTION(BlueprintPure, Category=UIDatasource) static FLinearColor	GetLinearColor(FUIDatasourceHandle Handle);
+	UFUNCTION(BlueprintPure, Category=UIDatasource) static int64		GetInt64(FUIDatasourceHandle Handle);
+	UFUNCTION(BlueprintPure, Category=UIDatasource) static double		GetDouble(FUIDatasourceHandle Handle);
 
 	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool	SetInt(FUIDatasourceHandle Handle, int32 Value);
 	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool	SetIntAsByte(FUIDatasourceHandle Handle, uint8 Value);
@@ -125,5 +163,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetMaterial(FUIDatasourceHandle Handle, TSoftObjectPtr<UMaterialInterface> Value);
 	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetGameplayTag(FUIDatasourceHandle Handle, FGameplayTag Value);
 	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetStruct(FUIDatasourceHandle Handle, FInstancedStruct Value);
+	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetVector2D(FUIDatasourceHandle Handle, FVector2D Value);
+	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetLinearColor(FUIDatasourceHandle Handle, FLinearColor Value);
+	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetInt64(FUIDatasourceHandle Handle, int64 Value);
+	UFUNCTION(BlueprintCallable, Category=UIDatasource) static bool SetDouble(FUIDatasourceHandle Handle, double Value);
 	// @formatter:on
+
+	// Copy the property at Field (e.g. Armor.Value) of the struct value into Value, used by field bindings (Path:Field).
+	// Returns false if the field doesn't exist or isn't of the type of Value.
+	UFUNCTION(BlueprintPure, CustomThunk, Category=UIDatasource, meta=(CustomStructureParam="Value", BlueprintInternalUseOnly="true"))
+	static bool GetStructField(FUIDatasourceHandle Handle, FName Field, int32& Value);
+	DECLARE_FUNCTION(execGetStructField);
 };
@@ -4,9 +4,15 @@
 
 #include "Modules/ModuleManager.h"
 
+enum class EReloadCompleteReason;
+
 class FUIDatasourceModule : public IModuleInterface
 {
 public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+	void OnReloadComplete(EReloadCompleteReason Reason);
 };
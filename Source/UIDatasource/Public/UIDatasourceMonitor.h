@@ -7,6 +7,104 @@
 struct FUIDatasourceLogEntry
 {
 	FUIDatasourceHandle Handle;
+	int32 DestroyedCount = 0; // Number of datasources in the subtree if this entry records its destruction
+};
+
+// Property inside a struct value resolved from a field binding path, cached per struct type
+struct FUIDatasourceResolvedField
+{
+	const FProperty* Property = nullptr;
+	int32 Offset = 0;
+
+	// Walk a dotted property path (e.g. Armor.Value) through nested structs, Property is null if a segment doesn't exist
+	static UIDATASOURCE_API FUIDatasourceResolvedField Resolve(const UStruct* Struct, FName Field);
+};
+
+// Node of the pattern subscription trie, one per pattern segment
+struct FUIDatasourcePatternNode
+{
+	TMap<FName, int32> Children; // Literal segments
+	int32 AnyChild = INDEX_NONE; // '*', exactly one segment
+	int32 AnyDescendants = INDEX_NONE; // '**', any number of segments (including none)
+	FOnDatasourceChangedDelegate Delegates; // Subscriptions whose pattern ends here
+};
+
+// Rate limit settings of a datasource and its pending trailing edge event
+struct FUIDatasourceRateLimitState
+{
+	FUIDatasourceRateLimit Settings;
+	double LastDeliveryTime = 0.0;
+	double LastChangeTime = 0.0;
+	double FirstPendingTime = 0.0;
+	uint32 SuppressedCount = 0; // Changes coalesced into an already pending event
+	bool bPending = false;
+};
+
+// Reads of a derived datasource functor go through this, every datasource read is registered as an input of the derived datasource
+struct UIDATASOURCE_API FUIDatasourceDeriveContext
+{
+	explicit FUIDatasourceDeriveContext(FUIDatasource& InTarget) : Target(InTarget) {}
+
+	// Datasource at Path relative to the parent of the derived datasource, nullptr if missing and read as an empty value.
+	// Derivations that read a missing input are evaluated again every tick until it exists.
+	FUIDatasource* Find(FStringView Path);
+	
+	// Numeric value (int, int64, float, double or bool) of Source as a double, 0 for anything else
+	double GetNumber(FUIDatasource* Source);
+	double GetNumber(FStringView Path) { return GetNumber(Find(Path)); }
+
+	template<typename T>
+	T Get(FUIDatasource* Source)
+	{
+		if(!Source)
+		{
+			return UIDatasource_DefaultValue<T>();
+		}
+		Dependencies.AddUnique(Source);
+		Source->Pull();
+		return Source->Get<T>();
+	}
+
+	// Derived datasource, the functor writes its result here
+	FUIDatasource& Target;
+	TArray<FUIDatasourceHandle, TInlineAllocator<4>> Dependencies;
+	bool bReadMissingInput = false;
+};
+
+// Computes the value of a derived datasource from Context reads, and sets it on Context.Target
+using FUIDatasourceDeriveFunc = TFunction<void(FUIDatasourceDeriveContext& Context)>;
+
+struct FUIDatasourceDerivation
+{
+	TSharedPtr<const FUIDatasourceDeriveFunc> Func; // Shared so an evaluation keeps it alive if the functor clears its own derivation
+	TArray<FUIDatasourceHandle, TInlineAllocator<4>> Dependencies; // Inputs read by the last evaluation
+	bool bDirty = true;
+	bool bIsCyclic = false; // Depends on itself, never evaluated again
+};
+
+// Produces the value of a provider datasource, by setting it on Datasource
+using FUIDatasourceProvideFunc = TFunction<void(FUIDatasource& Datasource)>;
+// Told when a provider datasource gets its first observer or loses its last one, to start or stop the upstream work.
+// A datasource destroyed while observed is told after the fact, its handle is already stale.
+using FUIDatasourceObservedFunc = TFunction<void(FUIDatasourceHandle Handle, bool bObserved)>;
+
+struct FUIDatasourceProvider
+{
+	FUIDatasourceProvideFunc Provide;
+	FUIDatasourceObservedFunc OnObservedChanged;
+	bool bStale = true; // Upstream changed since the last Provide
+};
+
+// Told when a datasource subtree gets its first observer (bObserved) or loses its last one
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDatasourceObservedChanged, FUIDatasourceHandle /*Handle*/, bool /*bObserved*/);
+
+// Observed change held back while the pool structure is written, so the callbacks can't touch a half updated pool
+struct FUIDatasourceDeferredObservedChange
+{
+	FUIDatasourceHandle Handle;
+	FUIDatasourceObservedFunc OnObservedChanged; // Of its provider, if any
+	FOnDatasourceObservedChanged Handlers;
+	bool bObserved = false;
 };
 
 struct FUIDatasourceMonitor
@@ -14,17 +112,127 @@ struct FUIDatasourceMonitor
 	TArray<FUIDatasourceLogEntry> Logs;
 	TArray<FUIDatasourceChangeEventArgs> QueuedEvents;
 	TArray<FUIDatasourceChangeEventArgs> QueuedEventsBuffer;
+	TSet<FUIDatasourceChangeEventArgs> QueuedEventSet; // Mirrors QueuedEvents for constant time dedupe
 	TMap<FUIDatasourceHandle, FOnDatasourceChangedDelegate> EventHandlers;
+	TMap<FUIDatasourceHandle, FOnDatasourceChangedNative> NativeEventHandlers;
+	TMap<FUIDatasourceHandle, TMap<FName, FOnDatasourceChangedDelegate>> FieldHandlers;
+	TMap<TPair<const UScriptStruct*, FName>, FUIDatasourceResolvedField> ResolvedFields;
+	TMap<FUIDatasourceHandle, FUIDatasourceRateLimitState> RateLimits;
+	TMap<FUIDatasourceHandle, FUIDatasourceDerivation> Derivations;
+	TMap<FUIDatasourceHandle, TArray<FUIDatasourceHandle>> DerivedDependents; // Input -> derived datasources reading it
+	TArray<FUIDatasourceHandle> DirtyDerivations;
+	TArray<FUIDatasourceHandle> WaitingDerivations; // Read a missing input on their last evaluation
+	TMap<FUIDatasourceHandle, FUIDatasourceProvider> Providers;
+	TArray<FUIDatasourceHandle> StaleProviders; // Observed providers to recompute on the next ProcessEvents
+	TMap<FUIDatasourceHandle, FOnDatasourceObservedChanged> ObservedChangedHandlers;
+	TArray<FUIDatasourcePatternNode> PatternNodes;
+	TArray<int32> FreePatternNodes; // Pruned PatternNodes slots, reused before growing the array
+	TMap<FUIDatasourceHandle, FOnDatasourceChangedDelegate> SubtreeHandlers;
+	TMap<FUIDatasourceHandle, TArray<FUIDatasourceHandle>> DirtySubtrees; // Subscribed datasource -> its children with changes under them this flush
+	uint32 SubtreeEpoch = 0;
+	TMap<FUIDatasourceHandle, int32> PatternRoots; // Scope datasource -> root node of the patterns relative to it
+	TArray<TWeakObjectPtr<UUIDatasourceTextFormatter>> PendingFormatters; // Format bindings with changed inputs, flushed once events are processed
+	int32 PendingRateLimitedCount = 0;
+	uint64 SuppressedEventCount = 0;
 
 	bool bProcessingEvents = false;
 	bool bCleanupDelegates = false;
 
 	void QueueDatasourceEvent(FUIDatasourceChangeEventArgs Event);
+	// Bulk version of QueueDatasourceEvent, reserves once for the whole batch (see FUIDatasourcePool::SetFloats)
+	void QueueDatasourceEvents(TConstArrayView<FUIDatasourceChangeEventArgs> Events);
 	void BindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate);
 	void UnbindDatasourceEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate);
+	
+	// Native handlers receive the same events as BindDatasourceEvent ones (except field events), without the ProcessEvent overhead
+	void BindDatasourceNativeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedNative::FDelegate& Delegate);
+	void UnbindDatasourceNativeEvent(FUIDatasourceHandle Handle, FDelegateHandle DelegateHandle);
+	
+	// Pattern subscriptions receive the events of every datasource under Scope (root if invalid) matching Pattern, a dot separated path
+	// where '*' matches any single segment and '**' any number of them (e.g. Items.*.Quantity). Events carry the matched handle, and
+	// datasources created later are matched too (see EUIDatasourceChangeEventKind::Attached). Field bindings (Path:Field) aren't
+	// supported by patterns and are rejected.
+	void BindDatasourcePatternEvent(FUIDatasourceHandle Scope, FStringView Pattern, const FOnDatasourceChangedDelegateBP& Delegate);
+	void UnbindDatasourcePatternEvent(FUIDatasourceHandle Scope, FStringView Pattern, const FOnDatasourceChangedDelegateBP& Delegate);
+	void OnDatasourceAttached(const FUIDatasource* Datasource);
+	// Existing datasources under Scope matching Pattern
+	static void GatherPatternMatches(FUIDatasource* Scope, FStringView Pattern, TArray<FUIDatasource*>& OutMatches);
+	
+	// Subtree bindings fire a single SubtreeChanged event per flush when the datasource or anything under it changed
+	void BindDatasourceSubtreeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate);
+	void UnbindDatasourceSubtreeEvent(FUIDatasourceHandle Handle, const FOnDatasourceChangedDelegateBP& Delegate);
+	// Children of Handle (or Handle itself if its own value changed) with changes under them, only valid while SubtreeChanged is broadcast
+	TConstArrayView<FUIDatasourceHandle> GetDirtyDescendants(FUIDatasourceHandle Handle) const;
+	
+	// Field bindings only fire when the property at Field (e.g. Armor.Value) changes in the struct value of the datasource
+	void BindDatasourceFieldEvent(FUIDatasourceHandle Handle, FName Field, const FOnDatasourceChangedDelegateBP& Delegate);
+	void UnbindDatasourceFieldEvent(FUIDatasourceHandle Handle, FName Field, const FOnDatasourceChangedDelegateBP& Delegate);
+	void QueueFieldEvents(const FUIDatasource* Datasource, const FInstancedStruct* OldValue, const FInstancedStruct& NewValue);
+	const FUIDatasourceResolvedField* ResolveField(const UScriptStruct* Struct, FName Field);
+	
+	// Delay value change events of Handle according to RateLimit, Mode None removes the limit (delivering any pending event)
+	void SetRateLimit(FUIDatasourceHandle Handle, const FUIDatasourceRateLimit& RateLimit);
+	const FUIDatasourceRateLimitState* FindRateLimit(FUIDatasourceHandle Handle) const { return RateLimits.Find(Handle); }
+
+	// Make Target a derived datasource, Func is evaluated lazily at most once per ProcessEvents after any of the datasources it read changed.
+	// Inputs are tracked automatically through the context, derivations depending on themselves are reported and disabled.
+	void SetDerived(FUIDatasource* Target, FUIDatasourceDeriveFunc Func);
+	// Derived datasource from an arithmetic expression over paths relative to the parent of Target (e.g. Health / MaxHealth),
+	// the result is stored as a float (or a double if Target already holds one). Returns false if Expression doesn't compile.
+	bool SetDerivedExpression(FUIDatasource* Target, FStringView Expression);
+	void ClearDerived(FUIDatasourceHandle Handle);
+	bool IsDerived(FUIDatasourceHandle Handle) const { return Derivations.Contains(Handle); }
+
+	// Make Datasource a provider, Provide is only called when the value is needed: when the first observer binds, on the next ProcessEvents
+	// after InvalidateProvider while observed, or on the next read (see FUIDatasource::Pull) while unobserved.
+	void SetProvider(FUIDatasource* Datasource, FUIDatasourceProvideFunc Provide, FUIDatasourceObservedFunc OnObservedChanged = {});
+	void ClearProvider(FUIDatasourceHandle Handle);
+	// Upstream data of the provider changed, its value will be produced again when next needed
+	void InvalidateProvider(FUIDatasourceHandle Handle);
+	void PullProvider(FUIDatasource* Datasource);
+	
+	// Observer counts are kept on the datasources by the Bind*Event calls (pattern subscriptions aren't counted), see FUIDatasource::IsObserved.
+	// Handlers are called when the subtree of Handle (itself included) starts or stops being observed.
+	FDelegateHandle BindObservedChanged(FUIDatasourceHandle Handle, const FOnDatasourceObservedChanged::FDelegate& Delegate);
+	void UnbindObservedChanged(FUIDatasourceHandle Handle, FDelegateHandle DelegateHandle);
+	// Drop every handler, rate limit, derivation and provider of datasources about to be destroyed, later unbinds of their stale handles are no-ops.
+	// Providers and ObservedChanged listeners of datasources still observed are added to OutDeferred, to be told they aren't anymore
+	// by NotifyObservedChanged once the datasources are gone.
+	void PurgeDatasources(TConstArrayView<FUIDatasourceHandle> Handles, TArray<FUIDatasourceDeferredObservedChange>& OutDeferred);
+	// Add Delta to the subtree observer count of From and its ancestors, used to carry observers along a moved subtree.
+	// Listeners are told right away, or added to OutDeferred when given.
+	void UpdateSubtreeObserverCounts(FUIDatasource* From, int32 Delta, TArray<FUIDatasourceDeferredObservedChange>* OutDeferred = nullptr);
+	static void NotifyObservedChanged(TConstArrayView<FUIDatasourceDeferredObservedChange> Changes);
+	
+	const FOnDatasourceChangedDelegate* FindEventHandlers(const FUIDatasourceChangeEventArgs& Event) const;
 	void ProcessEvents();
 	void Clear();
 
+	// Returns true if the event is held back by a rate limit, it will be queued again by FlushRateLimitedEvents
+	bool DeferRateLimitedEvent(const FUIDatasourceChangeEventArgs& Event);
+	void MarkDependentsDirty(FUIDatasourceHandle Input);
+	void EvaluateDerivations();
+	void EvaluateDerivation(FUIDatasourceHandle Handle, TArray<FUIDatasourceHandle, TInlineAllocator<8>>& Stack);
+	void UpdateDependencies(FUIDatasourceHandle Handle, FUIDatasourceDerivation& Derivation, TConstArrayView<FUIDatasourceHandle> Dependencies);
+	bool DependsOn(FUIDatasourceHandle Derived, FUIDatasourceHandle Input) const;
+	void FlushRateLimitedEvents();
+	void EnqueueEvent(const FUIDatasourceChangeEventArgs& Event);
+	void BroadcastEvent(const FUIDatasourceChangeEventArgs& Event);
+	void AddObserver(FUIDatasourceHandle Handle);
+	void RemoveObserver(FUIDatasourceHandle Handle);
+	void UpdateObserverCounts(FUIDatasource* Datasource, int32 Delta);
+	void EvaluateProviders();
+	void MarkSubtreeDirty(FUIDatasource* Datasource);
+	void BroadcastSubtreeEvents();
+	int32 FindPatternNode(FUIDatasourceHandle Scope, FStringView Pattern, bool bCreate);
+	int32 AllocatePatternNode();
+	// Free the nodes under NodeIndex without any subscription left (all of them if bForce), returns whether NodeIndex got freed
+	bool PrunePatternNode(int32 NodeIndex, bool bForce);
+	// Drop the roots of destroyed scopes and every node left without subscriptions
+	void PrunePatternNodes();
+	void GatherPatternSubscriptions(const FUIDatasource* Datasource, TArray<int32, TInlineAllocator<8>>& OutNodes) const;
+	void MatchPattern(int32 NodeIndex, TConstArrayView<FName> Segments, TArray<int32, TInlineAllocator<8>>& OutNodes) const;
+
 	DECLARE_MULTICAST_DELEGATE(FMonitorEventHandler)
 	FMonitorEventHandler OnMonitorEvent;
 };
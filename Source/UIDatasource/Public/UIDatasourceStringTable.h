@@ -0,0 +1,60 @@
+﻿// Copyright Sharundaar. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/StringView.h"
+
+// Handle to a string owned by a pool string table, identical strings share the same index so equality is an integer compare
+// Index 0 is the empty string and isn't refcounted
+struct FUIDatasourceInternedString
+{
+	uint32 Index = 0;
+
+	bool IsEmpty() const { return Index == 0; }
+	bool operator==(const FUIDatasourceInternedString& Other) const { return Index == Other.Index; }
+};
+
+// Refcounted string arena owned by a datasource pool, strings are packed null terminated in a single buffer
+// so churning lots of short strings (player names, clan tags...) doesn't hit the allocator for each of them.
+// Game thread only, like the rest of the pool.
+struct UIDATASOURCE_API FUIDatasourceStringTable
+{
+	FUIDatasourceStringTable();
+
+	// Returns a new reference to String, interning it if it's not already in the table
+	FUIDatasourceInternedString Intern(FStringView String);
+	void AddRef(FUIDatasourceInternedString String);
+	void Release(FUIDatasourceInternedString String);
+
+	// @NOTE: The returned view points in the arena, it's invalidated by the next Intern/Release call
+	FStringView Resolve(FUIDatasourceInternedString String) const;
+
+	// Drops every string at once, all outstanding handles become invalid
+	void Reset();
+
+	int32 Num() const { return Entries.Num() - FreeEntries.Num() - 1; }
+	int32 GetArenaSize() const { return Arena.Num(); }
+
+protected:
+	struct FEntry
+	{
+		int32 Offset = 0;
+		int32 Len = 0;
+		int32 RefCount = 0;
+		uint32 Hash = 0;
+	};
+
+	int32 FindEntry(FStringView String, uint32 Hash) const;
+	void Compact();
+
+	// Arena gets compacted once freed characters go over half of it (and over this threshold, no point reshuffling tiny arenas)
+	static constexpr int32 CompactThreshold = 4096;
+	
+	TArray<FEntry> Entries = {};
+	TArray<int32> FreeEntries = {};
+	TArray<TCHAR> Arena = {};
+	TMultiMap<uint32, int32> Lookup = {};
+	int32 WastedChars = 0;
+};
@@ -4,18 +4,36 @@
 
 #include "UIDatasource.h"
 #include "UIDatasourceMonitor.h"
+#include "Misc/ScopeExit.h"
 #include "Subsystems/EngineSubsystem.h"
 
 #include "UIDatasourceSubsystem.generated.h"
 
+UENUM(BlueprintType)
+enum class EUIDatasourceCloneMode : uint8
+{
+	Copy, // Values are copied as is
+	// FString values are stored as interned strings in the clones so every clone shares the payload. The FString accessors (Set, Emplace,
+	// Get and TryGet<FString>, SetString...) keep working on them and keep them interned, only Get_Ref<FString> needs the FString storage.
+	ShareStrings,
+};
+
 struct UIDATASOURCE_API FUIDatasourcePool
 {	
 public:
 	FUIDatasourcePool() = default;
 	FUIDatasource* Allocate();
+	// Allocate Count datasources in one sweep over the free slots, appended to OutAllocated. Allocates nothing and returns false if there isn't enough room.
+	bool AllocateMany(int32 Count, TArray<FUIDatasource*>& OutAllocated);
 
+	// Frees the datasource storage, the pool must be quiescent: no concurrent lookup or read may be in flight (checked when checks are enabled)
 	void Clear();
 	void Initialize();
+
+	// Initialize a detached pool, datasources built in it don't log changes nor queue events, so it can be filled from a worker thread
+	// and later spliced in the main pool with CommitStaging. The pool must not move in memory once initialized.
+	void InitializeAsStaging();
+	bool IsStaging() const { return bIsStaging; }
 	
 	FUIDatasourceHeader* GetHeaderDatasource();
 	const FUIDatasourceHeader* GetHeaderDatasource() const;
@@ -33,24 +51,174 @@ public:
 	FUIDatasource* FindDatasource(const FUIDatasource* Parent, FWideStringView Path) const;
 	FUIDatasource* FindDatasource(const FUIDatasource* Parent, FAnsiStringView Path) const;
 	
+	// Child creation goes through aliases like path lookups do, the child is attached to the alias target (or dropped in the sink if it dangles)
 	FUIDatasource* FindOrCreateChildDatasource(FUIDatasource* Parent, FName Name);
+	// Attach a new child without looking for an existing one first, caller guarantees Parent doesn't already have a child named Name
+	FUIDatasource* CreateChildDatasource(FUIDatasource* Parent, FName Name);
 	FUIDatasource* FindChildDatasource(const FUIDatasource* Parent, FName Name);
 
+	// Destroy Datasource and its whole subtree in one batch, a single change is logged for the subtree and its monitor state is purged
 	void DestroyDatasource(FUIDatasource* Datasource);
 
+	// Copy Source and its whole subtree under NewParent, named NewName unless None. All the nodes are allocated in one go and linked through
+	// an id remap, values, change policies and aliases are copied but bindings, providers and derivations stay on the source.
+	// Returns the clone of Source, nullptr if there isn't enough room in the pool, NewParent is an alias or already has a child with that name.
+	FUIDatasource* CloneSubtree(const FUIDatasource* Source, FUIDatasource* NewParent, FName NewName = NAME_None, EUIDatasourceCloneMode Mode = EUIDatasourceCloneMode::Copy);
+
+	// Move Datasource and its whole subtree under NewParent, renamed to NewName unless None. Only relinks ids so it's constant time (besides
+	// a walk up NewParent ancestors to refuse moving a datasource inside itself), handles, values and bindings of the subtree are kept
+	// and a single Reparented event is emitted. Fails if NewParent is an alias or already has another child named NewName.
+	bool Reparent(FUIDatasource* Datasource, FUIDatasource* NewParent, FName NewName = NAME_None);
+
+	// Attach a change policy to a datasource, float and double writes not deemed significant by it are dropped before any event is queued.
+	// A policy with Mode None removes it.
+	void SetChangePolicy(FUIDatasource* Datasource, const FUIDatasourceChangePolicy& Policy);
+	const FUIDatasourceChangePolicy* FindChangePolicy(const FUIDatasource* Datasource) const;
+
+	// Content hash of the current FInstancedStruct value of a HashStructValues datasource, 0 if unknown. Setting 0 removes it.
+	uint64 FindStructHash(const FUIDatasource* Datasource) const;
+	void SetStructHash(const FUIDatasource* Datasource, uint64 Hash);
+
+	// Make Alias point at Target, path lookups going through Alias (or ending on it) transparently continue on Target, so bindings made
+	// through the alias are bindings on the target and a single write serves both. Alias must not have children, Target nullptr removes the alias.
+	// Existing bindings stay on the previous target until their widget resolves its paths again. Concurrent lookups don't follow aliases.
+	// Returns false if the alias would form a cycle.
+	bool SetAlias(FUIDatasource* Alias, FUIDatasource* Target);
+	// Follow aliases to the datasource they point at, returns Datasource itself if it isn't an alias and nullptr if the target is gone
+	FUIDatasource* ResolveAlias(const FUIDatasource* Datasource) const;
+
+	// Batch writes for hot numeric values (nameplates, minimap...), Handles[Index] receives Values[Index]. Values are compared bit for bit
+	// with the current ones, only changed datasources are written and their events are queued in one go.
+	// Void datasources are initialized through the regular Set path, stale handles, sinks and mistyped datasources are skipped.
+	// Returns the number of datasources that changed.
+	int32 SetFloats(TConstArrayView<FUIDatasourceHandle> Handles, TConstArrayView<float> Values);
+	int32 SetInts(TConstArrayView<FUIDatasourceHandle> Handles, TConstArrayView<int32> Values);
+
+	// Polling support for consumers that can't bind delegates: record GetVersion() after reading, later HasChangedSince tells in O(1)
+	// whether the datasource (or anything under it if bIncludeChildren) changed since. Stale handles always report a change.
+	uint64 GetVersion() const { return Version; }
+	bool HasChangedSince(FUIDatasourceHandle Handle, uint64 SinceVersion, bool bIncludeChildren = false) const;
+	// Bump the version of the datasource value and of the subtree version of itself and its ancestors
+	void StampVersion(const FUIDatasource* Datasource);
+
+	// Game thread only, moves the whole content of the Staging pool root under the child Name of Parent, the staging pool is cleared afterward.
+	// Previous children of the target are destroyed, but the target itself is kept so existing handles and bindings stay valid.
+	// Emits a single change for the whole subtree, returns the target datasource or nullptr if there isn't enough room in this pool.
+	FUIDatasource* CommitStaging(FUIDatasourcePool& Staging, FUIDatasource* Parent, FName Name);
+
+	// Worker thread safe lookup, resolves Path from Parent (or root if Parent is invalid) and returns an invalid handle if the path
+	// doesn't exist or if the tree kept changing under us for too long. Never allocates datasources.
+	FUIDatasourceHandle FindDatasourceConcurrent(FUIDatasourceHandle Parent, FWideStringView Path) const;
+	FUIDatasourceHandle FindDatasourceConcurrent(FUIDatasourceHandle Parent, FAnsiStringView Path) const;
+
+	// Worker thread safe read of a datasource value, only available for trivially copyable types (int32, float, bool, FName, FGameplayTag...)
+	// as heap backed values can be freed by the game thread while we copy them. Returns false if the handle is stale, the type mismatches
+	// or the value kept changing for too long.
+	template<typename T>
+	bool TryGetConcurrent(FUIDatasourceHandle Handle, T& OutValue) const;
+
+	// Structural changes (allocation, linking, renaming, destruction) are wrapped in these so concurrent lookups can detect them, nestable
+	void BeginStructureWrite();
+	void EndStructureWrite();
+	int32 ReadStructureSequence() const { return FPlatformAtomics::AtomicRead(&StructureSequence); }
+
+	// Concurrent lookups and reads in flight, only tracked to catch a Clear racing with them
+#if DO_CHECK
+	void BeginConcurrentRead() const { FPlatformAtomics::InterlockedIncrement(&ConcurrentReaders); }
+	void EndConcurrentRead() const { FPlatformAtomics::InterlockedDecrement(&ConcurrentReaders); }
+#else
+	void BeginConcurrentRead() const {}
+	void EndConcurrentRead() const {}
+#endif
+
+	// Backing storage of interned string values, see FUIDatasource::SetInterned
+	FUIDatasourceStringTable& GetStringTable() { return Strings; }
+	const FUIDatasourceStringTable& GetStringTable() const { return Strings; }
+
 	int32 Num() const { return AllocatedCount; };
 	static constexpr int Capacity() { return ChunkSize; }
+	static constexpr int MaxConcurrentReadAttempts = 64;
+	static constexpr int MaxAliasHops = 8;
 	
 protected:
 	static constexpr int ChunkSize = 4096;
 	TArray<FUIDatasource> Datasources = {};
 	int FirstFree = 0;
 	int AllocatedCount = 0;
+	bool bIsStaging = false;
+	uint64 Version = 0;
+	FUIDatasourceStringTable Strings;
+	// Side table as only a handful of datasources have one, keeps FUIDatasource small
+	TMap<EUIDatasourceId, FUIDatasourceChangePolicy> ChangePolicies;
+	TMap<EUIDatasourceId, uint64> StructHashes;
+	TMap<EUIDatasourceId, FUIDatasourceHandle> Aliases;
+
+	// Seqlock over the tree topology, odd while a structural write is in progress
+	int32 StructureSequence = 0;
+	int32 StructureWriteDepth = 0;
+#if DO_CHECK
+	mutable int32 ConcurrentReaders = 0;
+#endif
 
 public:
 	static FUIDatasource SinkDatasource; // Special datasource that no-ops
+
+private:
+	FUIDatasource* InitializeAllocated(int32 Index);
 };
 
+template<typename T>
+bool FUIDatasourcePool::TryGetConcurrent(FUIDatasourceHandle Handle, T& OutValue) const
+{
+	UIDATASOURCE_FUNC_TRACE()
+	
+	static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read concurrently, heap backed values may be freed while copying.");
+	static_assert(FUIDatasourceValue::FValueType::IndexOfType<T>() != static_cast<SIZE_T>(-1), "Tried to get datasource to invalid type.");
+
+	BeginConcurrentRead();
+	ON_SCOPE_EXIT { EndConcurrentRead(); };
+	
+	FUIDatasourceGeneration Generation;
+	EUIDatasourceId Id;
+	UIDatasource_UnpackId(Handle.Id, Generation, Id);
+	if(Id == EUIDatasourceId::Invalid || ToIndex(Id) >= Datasources.Num())
+	{
+		return false;
+	}
+
+	const FUIDatasource& Datasource = Datasources[ToIndex(Id)];
+	for(int32 Attempt = 0; Attempt < MaxConcurrentReadAttempts; ++Attempt)
+	{
+		const int32 SequenceBegin = FPlatformAtomics::AtomicRead(&Datasource.ValueSequence);
+		if(SequenceBegin & 1)
+		{
+			FPlatformProcess::YieldThread();
+			continue;
+		}
+
+		const bool bIsValid = Datasource.Generation == Generation && Datasource.Id == Id;
+		const T* ValuePtr = Datasource.Value.Value.template TryGet<T>();
+		T Copy;
+		if(bIsValid && ValuePtr)
+		{
+			FMemory::Memcpy(&Copy, ValuePtr, sizeof(T));
+		}
+		
+		FPlatformMisc::MemoryBarrier();
+		if(FPlatformAtomics::AtomicRead(&Datasource.ValueSequence) == SequenceBegin)
+		{
+			if(!bIsValid || !ValuePtr)
+			{
+				return false;
+			}
+			OutValue = Copy;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 UCLASS()
 class UIDATASOURCE_API UUIDatasourceSubsystem : public UEngineSubsystem
 {
@@ -12,6 +12,10 @@
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FUIDatasourceChangedDelegate, FUIDatasourceHandle, Handle);
 
+class UTextBlock;
+class UWidget;
+class UUIDatasourceUserWidgetExtension;
+
 // Represents the type of binding we operate with regard to a datasource
 UENUM(BlueprintType)
 enum class EDatasourceBindType : uint8
@@ -48,6 +52,10 @@ struct FUIDataBind
 	FOnDatasourceChangedDelegateBP Bind;
 	FString Path;
 	EDatasourceBindType BindType;
+	FName Field = {}; // Property path in the struct value, split from Path on ':' (e.g. Stats:Armor.Value)
+	FOnDatasourceChangedNative::FDelegate NativeBind = {}; // Used instead of Bind when bound, see FUIDatasourcePropertyBinder
+	bool bIsPattern = false; // Path contains wildcards (e.g. Items.*.Quantity), Bind receives the events of every match
+	bool bIsSubtree = false; // Path ends with "..." (e.g. Player.Equipment...), Bind receives a SubtreeChanged event once per flush
 };
 
 struct UIDATASOURCE_API FUIDatasourceLink
@@ -59,6 +67,124 @@ struct UIDATASOURCE_API FUIDatasourceLink
 	void UpdateBindings(FUIDatasourceHandle OldHandle, FUIDatasourceHandle NewHandle);
 	void AddBinding(const FUIDataBind& Binding);
 	void LinkGlobalBindings(bool bLink);
+
+	// Split a binding path in its datasource path and struct field path parts, Field is None if there isn't any
+	static void SplitFieldPath(FStringView BindingPath, FStringView& OutPath, FName& OutField);
+};
+
+// Format binding compiled from UUIDatasourceWidgetBlueprintExtension::FormatBindings
+USTRUCT()
+struct UIDATASOURCE_API FUIDataFormatBindTemplate
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName TextBlockName = {};
+
+	UPROPERTY()
+	FText Format = {};
+
+	// Argument names of Format extracted at blueprint compile time, each one is a datasource path
+	UPROPERTY()
+	TArray<FString> Arguments;
+
+	UPROPERTY()
+	EDatasourceBindType BindType = EDatasourceBindType::Self;
+};
+
+// How a datasource value is converted before being written in a widget property
+UENUM()
+enum class EUIDatasourcePropertyConversion : uint8
+{
+	Direct, // Value written as is, the property must be of the datasource value type (int, float, bool, FText, FName, FString, FLinearColor, FVector2D...)
+	BoolToVisibility, // true is Visible, false is Collapsed
+	BoolToVisibilityInverted, // true is Collapsed, false is Visible
+	FloatToProgress, // Numeric value clamped to [0, 1] in a float property (e.g. ProgressBar Percent)
+	NumberToText, // Numeric value formatted as an FText (e.g. TextBlock Text)
+};
+
+// Property binding compiled from UUIDatasourceWidgetBlueprintExtension::PropertyBindings
+USTRUCT()
+struct UIDATASOURCE_API FUIDataPropertyBindTemplate
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName WidgetName = {};
+
+	UPROPERTY()
+	FName PropertyName = {};
+
+	UPROPERTY()
+	FString Path = {};
+
+	UPROPERTY()
+	EDatasourceBindType BindType = EDatasourceBindType::Self;
+
+	UPROPERTY()
+	EUIDatasourcePropertyConversion Conversion = EUIDatasourcePropertyConversion::Direct;
+};
+
+// Writes a datasource value straight in a widget property through a native delegate, the property is written with its native
+// setter when it declares one (Text, Visibility, Percent...), so no blueprint graph nor ProcessEvent is involved
+struct UIDATASOURCE_API FUIDatasourcePropertyBinder : TSharedFromThis<FUIDatasourcePropertyBinder>
+{
+	// Convert Source in OutValue, an initialized value of Property, returns false if the value can't be converted
+	using FConverter = bool(*)(const FUIDatasource& Source, const FProperty* Property, void* OutValue);
+
+	FUIDatasourcePropertyBinder(UUserWidget* InUserWidget, const FUIDataPropertyBindTemplate& Template);
+	~FUIDatasourcePropertyBinder();
+
+	void OnDatasourceChanged(const FUIDatasourceChangeEventArgs& EventArgs);
+
+	// Whether a property can receive values through the given conversion, used to validate bindings at blueprint compile time
+	static bool IsCompatible(const FProperty* Property, EUIDatasourcePropertyConversion Conversion);
+	static FConverter GetConverter(EUIDatasourcePropertyConversion Conversion);
+
+protected:
+	bool ResolveProperty();
+	
+	TWeakObjectPtr<UUserWidget> UserWidget;
+	TWeakObjectPtr<UWidget> Widget;
+	FName WidgetName;
+	FName PropertyName;
+	EUIDatasourcePropertyConversion Conversion;
+	const FProperty* Property = nullptr; // Cached on first write, widget classes don't change at runtime
+	FConverter Converter = nullptr;
+	void* ValueBuffer = nullptr; // Scratch value of Property the conversion writes to
+};
+
+// Per widget instance state of a format binding, input changes are accumulated and the text is formatted once per monitor flush
+UCLASS(Transient)
+class UIDATASOURCE_API UUIDatasourceTextFormatter : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Setup(UUserWidget* InUserWidget, const FUIDataFormatBindTemplate& Template, const FTextFormat& InFormat);
+
+	UFUNCTION()
+	void OnInputChanged(FUIDatasourceChangeEventArgs EventArgs);
+
+	// Refresh the arguments of the changed inputs and push the formatted text to the text block
+	void Flush();
+	// Drop the accumulated changes, for when the monitor throws its pending formatters away
+	void CancelPending();
+
+protected:
+	TWeakObjectPtr<UUserWidget> UserWidget;
+	TWeakObjectPtr<UTextBlock> TextBlock;
+	FName TextBlockName;
+	FTextFormat Format;
+	TArray<FString> ArgumentPaths;
+	// Datasource of every argument path, resolved again only when the scope or the pool structure changed
+	TArray<FUIDatasourceHandle, TInlineAllocator<4>> ArgumentHandles;
+	FUIDatasourceHandle ResolvedScope;
+	int32 ResolvedStructureSequence = INDEX_NONE;
+	EDatasourceBindType BindType = EDatasourceBindType::Self;
+	FFormatNamedArguments Arguments; // Converted value of every input, only changed ones are converted again
+	TArray<FUIDatasourceHandle, TInlineAllocator<4>> ChangedInputs;
+	bool bPending = false;
 };
 
 UCLASS()
@@ -83,12 +209,19 @@ public:
 	static UUIDatasourceUserWidgetExtension* RegisterDatasourceExtension(UUserWidget* UserWidget);
 	
 	void AddBinding(const FUIDataBind& Binding);
+	void AddFormatBinding(const FUIDataFormatBindTemplate& Template, const FTextFormat& Format);
+	void AddPropertyBinding(const FUIDataPropertyBindTemplate& Template);
 	
 	virtual void Construct() override;
 	virtual void Destruct() override;
 
 protected:
 	FUIDatasourceLink Linker;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUIDatasourceTextFormatter>> Formatters;
+
+	TArray<TSharedRef<FUIDatasourcePropertyBinder>> PropertyBinders;
 };
 
 USTRUCT()
@@ -124,4 +257,14 @@ public:
 
 	UPROPERTY()
 	TArray<FUIDataBindTemplate> Bindings;
+
+	UPROPERTY()
+	TArray<FUIDataFormatBindTemplate> FormatBindings;
+
+	UPROPERTY()
+	TArray<FUIDataPropertyBindTemplate> PropertyBindings;
+
+protected:
+	// FTextFormat of each format binding, built once for the class on first instantiation
+	TArray<FTextFormat> CompiledFormats;
 };
@@ -12,6 +12,7 @@
 #include "UIDatasourceArchetype.h"
 #include "UIDatasourceBlueprintLibrary.h"
 #include "UIDatasourceEditorHelpers.h"
+#include "UIDatasourceMonitor.h"
 #include "UIDatasourceWidgetBlueprintExtension.h"
 #include "WidgetBlueprint.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -48,7 +49,13 @@ void UK2Node_UIDatasourceSingleBinding::CreateProperlyTypedModelOutputPin()
 		Pins.RemoveAt(HandlePinPosition, 1, false);
 	}
 
-	FEdGraphPinType PinType = UIDatasourceEditorHelpers::GetPinTypeForDescriptor(UK2Node_UIDatasourceSingleBinding_Local::GenerateDescriptorForNode(this));
+	// Field bindings output the field value, not the struct held by the datasource
+	FEdGraphPinType PinType;
+	const FProperty* FieldProperty = FindFieldProperty();
+	if (!FieldProperty || !GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(FieldProperty, PinType))
+	{
+		PinType = UIDatasourceEditorHelpers::GetPinTypeForDescriptor(UK2Node_UIDatasourceSingleBinding_Local::GenerateDescriptorForNode(this));
+	}
 
 	CreatePin(EGPD_Output, PinType, *Path, HandlePinPosition);
 
@@ -75,9 +82,40 @@ void UK2Node_UIDatasourceSingleBinding::AllocateDefaultPins()
 
 FName UK2Node_UIDatasourceSingleBinding::GetGeneratedEventName() const
 {
+	// Paths hold separators ('.', ':') that aren't valid in function names, the hash keeps paths only differing by them apart
+	FString EventPath = Path;
+	for (TCHAR& Char : EventPath)
+	{
+		if (!FChar::IsAlnum(Char) && Char != TEXT('_'))
+		{
+			Char = TEXT('_');
+		}
+	}
+	if (EventPath != Path)
+	{
+		return FName(*FString::Printf(TEXT("DataBndEvt_%s_%08x_Changed"), *EventPath, GetTypeHash(Path)));
+	}
 	return FName(*FString::Printf(TEXT("DataBndEvt_%s_Changed"), *Path));
 }
 
+FName UK2Node_UIDatasourceSingleBinding::GetField() const
+{
+	FStringView BindPath;
+	FName Field;
+	FUIDatasourceLink::SplitFieldPath(Path, BindPath, Field);
+	return Field;
+}
+
+const FProperty* UK2Node_UIDatasourceSingleBinding::FindFieldProperty() const
+{
+	const FName Field = GetField();
+	if (Field.IsNone() || Type != EUIDatasourceValueType::Struct || !FieldStruct)
+	{
+		return nullptr;
+	}
+	return FUIDatasourceResolvedField::Resolve(FieldStruct, Field).Property;
+}
+
 bool UK2Node_UIDatasourceSingleBinding::CheckForErrors(const FKismetCompilerContext& CompilerContext) const
 {
 	if(Path.IsEmpty())
@@ -86,6 +124,29 @@ bool UK2Node_UIDatasourceSingleBinding::CheckForErrors(const FKismetCompilerCont
 		return true;
 	}
 
+	const FName Field = GetField();
+	if(!Field.IsNone())
+	{
+		if(Type != EUIDatasourceValueType::Struct || !FieldStruct)
+		{
+			CompilerContext.MessageLog.Error(*FString::Printf(TEXT("Field binding %s on node @@ needs the Struct type and the struct held by the datasource."), *Path), this);
+			return true;
+		}
+
+		FEdGraphPinType PinType;
+		const FProperty* FieldProperty = FindFieldProperty();
+		if(!FieldProperty)
+		{
+			CompilerContext.MessageLog.Error(*FString::Printf(TEXT("Field %s doesn't exist in struct %s on node @@."), *Field.ToString(), *FieldStruct->GetName()), this);
+			return true;
+		}
+		if(!GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(FieldProperty, PinType))
+		{
+			CompilerContext.MessageLog.Error(*FString::Printf(TEXT("Field %s of struct %s on node @@ isn't a blueprint type."), *Field.ToString(), *FieldStruct->GetName()), this);
+			return true;
+		}
+	}
+
 	return false;
 }
 
@@ -115,7 +176,19 @@ void UK2Node_UIDatasourceSingleBinding::ExpandNode(FKismetCompilerContext& Compi
 	checkf(HandlePin->PinType.PinCategory == UEdGraphSchema_K2::PC_Struct && HandlePin->PinType.PinSubCategoryObject == FUIDatasourceHandle::StaticStruct(), TEXT("If this hits, probably means FUIDatasourceChangeEventArgs field order changed."));
 	
 	const bool bNeitherNoneOrArchetypeType = !(Type == EUIDatasourceValueType::Void || Type == EUIDatasourceValueType::Archetype);
-	if (bNeitherNoneOrArchetypeType)
+	if (const FProperty* FieldProperty = FindFieldProperty())
+	{
+		// Read the field out of the struct value, the wildcard value pin takes the field type
+		UK2Node_CallFunction* GetFieldNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+		GetFieldNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetStructField), UUIDatasourceBlueprintLibrary::StaticClass());
+		GetFieldNode->AllocateDefaultPins();
+		HandlePin->MakeLinkTo(GetFieldNode->FindPinChecked(TEXT("Handle")));
+		GetFieldNode->FindPinChecked(TEXT("Field"))->DefaultValue = GetField().ToString();
+		UEdGraphPin* ValuePin = GetFieldNode->FindPinChecked(TEXT("Value"));
+		GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(FieldProperty, ValuePin->PinType);
+		HandlePin = ValuePin;
+	}
+	else if (bNeitherNoneOrArchetypeType)
 	{
 		UK2Node_CallFunction* GetDatasourceValueNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
 		GetDatasourceValueNode->FunctionReference = UIDatasourceEditorHelpers::GetGetterFunctionForDescriptor(UK2Node_UIDatasourceSingleBinding_Local::GenerateDescriptorForNode(this));
@@ -294,7 +367,8 @@ void UK2Node_UIDatasourceSingleBinding::PostEditChangeProperty(FPropertyChangedE
 
 	if(PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_UIDatasourceSingleBinding, Path)
 		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_UIDatasourceSingleBinding, Type)
-		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_UIDatasourceSingleBinding, EnumPath))
+		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_UIDatasourceSingleBinding, EnumPath)
+		|| PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UK2Node_UIDatasourceSingleBinding, FieldStruct))
 	{
 		CreateProperlyTypedModelOutputPin();
 	}
@@ -15,8 +15,10 @@
 #include "WorkspaceMenuStructure.h"
 #include "WorkspaceMenuStructureModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "BlueprintModes/WidgetBlueprintApplicationModes.h"
 #include "Engine/Texture2D.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Materials/MaterialInstance.h"
 #include "Styling/SlateStyleMacros.h"
@@ -24,6 +26,7 @@
 #include "Styling/StyleColors.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Colors/SColorBlock.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SComboBox.h"
 #include "Widgets/Input/SEditableTextBox.h"
@@ -583,6 +586,7 @@ public:
 	static FName NAME_Name;
 	static FName NAME_ValueType;
 	static FName NAME_Value;
+	static FName NAME_Observers;
 
 	SLATE_BEGIN_ARGS(SUIDatasourceDebuggerTreeViewItem)
 	{}
@@ -602,6 +606,7 @@ SLATE_IMPLEMENT_WIDGET(SUIDatasourceDebuggerTreeViewItem);
 FName SUIDatasourceDebuggerTreeViewItem::NAME_Name("Name");
 FName SUIDatasourceDebuggerTreeViewItem::NAME_ValueType("ValueType");
 FName SUIDatasourceDebuggerTreeViewItem::NAME_Value("Value");
+FName SUIDatasourceDebuggerTreeViewItem::NAME_Observers("Observers");
 
 void SUIDatasourceDebuggerTreeViewItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
 {
@@ -653,6 +658,23 @@ TSharedRef<SWidget> SUIDatasourceDebuggerTreeViewItem::GenerateWidgetForColumn(c
 			+SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center)[SNew(STextBlock).Text(FUIArrayDatasource::IsArray(Datasource) ? INVTEXT("Array") : UEnum::GetDisplayValueAsText(ValueType))];
 	}
 
+	if(InColumnName == NAME_Observers)
+	{
+		// Own observers, then observers of the whole subtree, unwatched datasources are dimmed
+		const FUIDatasourceHandle Handle = Node->Handle;
+		return SNew(STextBlock)
+			.Text_Lambda([Handle]()
+			{
+				const FUIDatasource* Datasource = Handle.Get();
+				return Datasource ? FText::Format(INVTEXT("{0} ({1})"), Datasource->GetObserverCount(), Datasource->GetSubtreeObserverCount()) : FText::GetEmpty();
+			})
+			.ColorAndOpacity_Lambda([Handle]()
+			{
+				const FUIDatasource* Datasource = Handle.Get();
+				return Datasource && Datasource->IsSubtreeObserved() ? FSlateColor::UseForeground() : FSlateColor::UseSubduedForeground();
+			});
+	}
+
 	if(InColumnName == NAME_Value)
 	{
 		FUIDatasource* Datasource = Node->Handle.Get();
@@ -706,10 +728,10 @@ TSharedRef<SWidget> SUIDatasourceDebuggerTreeViewItem::GenerateWidgetForColumn(c
 			return SNew(SEditableTextBox).Text_Lambda([Datasource]()
 			{
 				FString Value;
-				return Datasource->Value.TryGet<FString>(Value) ? FText::FromString(Value) : INVTEXT("");
+				return Datasource->TryGetString(Value) ? FText::FromString(Value) : INVTEXT("");
 			}).OnTextCommitted_Lambda([Datasource](const FText& Text, ETextCommit::Type CommitType)
 			{
-				Datasource->Set(Text.ToString());
+				Datasource->SetString(Text.ToString());
 			});
 		case EUIDatasourceValueType::Image:
 			return SNew(SHorizontalBox)
@@ -768,6 +790,46 @@ TSharedRef<SWidget> SUIDatasourceDebuggerTreeViewItem::GenerateWidgetForColumn(c
 				ScriptStruct->ExportText(StrRep, Value.GetMemory(), {}, nullptr, PPF_PropertyWindow, nullptr);
 				return FText::AsCultureInvariant(StrRep);
 			});
+		case EUIDatasourceValueType::Vector2D:
+			return SNew(STextBlock).Text_Lambda([Datasource]()
+			{
+				FVector2D Value;
+				return Datasource->Value.TryGet<FVector2D>(Value) ? FText::AsCultureInvariant(Value.ToString()) : INVTEXT("");
+			});
+		case EUIDatasourceValueType::LinearColor:
+			return SNew(SHorizontalBox)
+				+SHorizontalBox::Slot().MaxWidth(32.0f)
+				[
+					SNew(SColorBlock).Color_Lambda([Datasource]()
+					{
+						return Datasource->Get<FLinearColor>();
+					})
+				]
+				+SHorizontalBox::Slot().FillWidth(1.0f).Padding(4.0f, 0.0f)
+				[
+					SNew(STextBlock).Text_Lambda([Datasource]()
+					{
+						return FText::AsCultureInvariant(Datasource->Get<FLinearColor>().ToString());
+					})
+				];
+		case EUIDatasourceValueType::Int64:
+			return SNew(SNumericEntryBox<int64>).Value_Lambda([Datasource]()
+			{
+				int64 Value;
+				return Datasource->Value.TryGet<int64>(Value) ? Value : 0;
+			}).OnValueCommitted_Lambda([Datasource](int64 InValue, ETextCommit::Type InCommitType)
+			{
+				Datasource->Set(InValue);
+			});
+		case EUIDatasourceValueType::Double:
+			return SNew(SNumericEntryBox<double>).Value_Lambda([Datasource]()
+			{
+				double Value;
+				return Datasource->Value.TryGet<double>(Value) ? Value : 0.0;
+			}).OnValueCommitted_Lambda([Datasource](double InValue, ETextCommit::Type InCommitType)
+			{
+				Datasource->Set(InValue);
+			});
 		case EUIDatasourceValueType::GameplayTag:
 			break;
 		case EUIDatasourceValueType::Archetype:
@@ -886,6 +948,86 @@ void SUIDatasourceDebugger::Construct(const FArguments& InArgs)
 				
 				return FReply::Handled();
 			}) ]
+			+ SHorizontalBox::Slot().AutoWidth() [ SNew(SButton).Text(INVTEXT("Concurrent Stress Test")).OnClicked_Lambda([this]()
+			{
+				TRACE_BOOKMARK(L"UIDatasource Concurrent Stress Test")
+				FUIDatasourcePool* Pool = &UUIDatasourceSubsystem::Get()->Pool;
+				FUIDatasource& Counter = (*Pool->GetRootDatasource())["ConcurrentStress.Counter"];
+				FUIDatasource& Churn = (*Pool->GetRootDatasource())["ConcurrentStress.Churn"];
+				Counter.Set<int32>(0);
+
+				// Readers check the counter never goes backward while the game thread keeps incrementing it and churning nodes around it
+				struct FReaderState
+				{
+					std::atomic<bool> bStop = false;
+					std::atomic<int32> Reads = 0;
+					std::atomic<int32> Errors = 0;
+				};
+				TSharedRef<FReaderState> State = MakeShared<FReaderState>();
+				TArray<TFuture<void>> Readers;
+				for(int32 ReaderIdx = 0; ReaderIdx < 4; ++ReaderIdx)
+				{
+					Readers.Add(Async(EAsyncExecution::ThreadPool, [State, Pool]()
+					{
+						int32 LastValue = 0;
+						while(!State->bStop)
+						{
+							int32 Value;
+							const FUIDatasourceHandle Handle = Pool->FindDatasourceConcurrent({}, TEXT("ConcurrentStress.Counter"));
+							if(Handle.IsValid() && Pool->TryGetConcurrent(Handle, Value))
+							{
+								State->Errors += Value < LastValue ? 1 : 0;
+								State->Reads++;
+								LastValue = Value;
+							}
+						}
+					}));
+				}
+
+				char Buff[] = "Item0";
+				for(int32 Rep=1; Rep<20000; ++Rep)
+				{
+					Counter.Set<int32>(Rep);
+					Buff[4] = '0' + Rep % 8;
+					FUIDatasource* Child = Churn.FindOrCreateFromPath(Buff);
+					if(Rep % 3 == 0)
+					{
+						Pool->DestroyDatasource(Child);
+					}
+				}
+
+				State->bStop = true;
+				for(TFuture<void>& Reader : Readers)
+				{
+					Reader.Wait();
+				}
+				UE_LOG(LogDatasource, Display, TEXT("Concurrent stress test finished, %d reads, %d errors."), State->Reads.load(), State->Errors.load());
+				return FReply::Handled();
+			}) ]
+			+ SHorizontalBox::Slot().AutoWidth() [ SNew(SButton).Text(INVTEXT("Allocation Test")).OnClicked_Lambda([this]()
+			{
+				FUIDatasource& Datasource = (*UUIDatasourceSubsystem::Get()->Pool.GetRootDatasource())["AllocationTest.String"];
+				const FString SameValue = TEXT("Redundant writes shouldn't allocate");
+				Datasource.Set<FString>(SameValue);
+
+				// Redundant writes are all rejected by the compare and must leave the stored string buffer alone. Allocations made in
+				// the loop are tagged for LLM, a memory Insights trace (-trace=memory) shows whether anything allocated under the bookmark.
+				const TCHAR* StoredBuffer = Datasource.Get_Ref<FString>().GetCharArray().GetData();
+				{
+					TRACE_BOOKMARK(L"UIDatasource Allocation Test")
+					LLM_SCOPE_BYNAME(TEXT("UIDatasource/RedundantWrites"));
+					for(int32 Rep=0; Rep<1000; ++Rep)
+					{
+						Datasource.Set<FString>(SameValue);
+						Datasource.Emplace<FString>(TEXT("Redundant writes shouldn't allocate"));
+					}
+				}
+
+				const bool bReusedBuffer = Datasource.Get_Ref<FString>().GetCharArray().GetData() == StoredBuffer;
+				ensureMsgf(bReusedBuffer, TEXT("Redundant datasource writes reallocated the stored string."));
+				UE_LOG(LogDatasource, Display, TEXT("Allocation test finished, stored string %s."), bReusedBuffer ? TEXT("untouched") : TEXT("reallocated"));
+				return FReply::Handled();
+			}) ]
 			+ SHorizontalBox::Slot().AutoWidth() [ SNew(SButton).Text(INVTEXT("Reset Pool")).OnClicked_Lambda([this]()
 			{
 				FUIDatasourcePool& Pool = UUIDatasourceSubsystem::Get()->Pool;
@@ -920,6 +1062,28 @@ void SUIDatasourceDebugger::Construct(const FArguments& InArgs)
 						})
 						.TextStyle(FUIDatasourceStyle::Get(), "Normal")
 				]
+				+SVerticalBox::Slot().AutoHeight()
+				[
+					SNew(STextBlock)
+						.Text_Lambda([]()
+						{
+							const FUIDatasourceStringTable& Strings = UUIDatasourceSubsystem::Get()->Pool.GetStringTable();
+							return FText::FormatOrdered(INVTEXT("Interned strings: {0} (Arena: {1} chars)"), Strings.Num(), Strings.GetArenaSize());
+						})
+						.TextStyle(FUIDatasourceStyle::Get(), "Normal")
+				]
+#if WITH_UIDATASOURCE_MONITOR
+				+SVerticalBox::Slot().AutoHeight()
+				[
+					SNew(STextBlock)
+						.Text_Lambda([]()
+						{
+							const FUIDatasourceMonitor& Monitor = UUIDatasourceSubsystem::Get()->Monitor;
+							return FText::FormatOrdered(INVTEXT("Rate limited datasources: {0} (Pending: {1}, Suppressed events: {2})"), Monitor.RateLimits.Num(), Monitor.PendingRateLimitedCount, Monitor.SuppressedEventCount);
+						})
+						.TextStyle(FUIDatasourceStyle::Get(), "Normal")
+				]
+#endif
 			]
 		]
 		+ SVerticalBox::Slot().AutoHeight() [
@@ -948,6 +1112,11 @@ void SUIDatasourceDebugger::Construct(const FArguments& InArgs)
 				+SHeaderRow::Column(SUIDatasourceDebuggerTreeViewItem::NAME_Value)
 				.DefaultLabel(INVTEXT("Value"))
 				.ShouldGenerateWidget(true)
+				
+				+SHeaderRow::Column(SUIDatasourceDebuggerTreeViewItem::NAME_Observers)
+				.DefaultLabel(INVTEXT("Observers"))
+				.DefaultTooltip(INVTEXT("Delegates bound to the datasource, and to the datasource or anything under it in parentheses"))
+				.FixedWidth(80.f)
 			)
 		]
 	];
@@ -55,6 +55,21 @@ FEdGraphPinType UIDatasourceEditorHelpers::GetPinTypeForDescriptor(const FUIData
 			PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
 			PinType.PinSubCategoryObject = FInstancedStruct::StaticStruct();
 			break;
+		case EUIDatasourceValueType::Vector2D:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+			PinType.PinSubCategoryObject = TBaseStructure<FVector2D>::Get();
+			break;
+		case EUIDatasourceValueType::LinearColor:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
+			PinType.PinSubCategoryObject = TBaseStructure<FLinearColor>::Get();
+			break;
+		case EUIDatasourceValueType::Int64:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Int64;
+			break;
+		case EUIDatasourceValueType::Double:
+			PinType.PinCategory = UEdGraphSchema_K2::PC_Real;
+			PinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
+			break;
 		case EUIDatasourceValueType::Archetype:
 		case EUIDatasourceValueType::Void: // default to sending the datasource handle
 			PinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
@@ -101,6 +116,18 @@ FMemberReference UIDatasourceEditorHelpers::GetGetterFunctionForDescriptor(const
 	case EUIDatasourceValueType::Struct:
 		GetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetStruct);
 		break;
+	case EUIDatasourceValueType::Vector2D:
+		GetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetVector2D);
+		break;
+	case EUIDatasourceValueType::LinearColor:
+		GetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetLinearColor);
+		break;
+	case EUIDatasourceValueType::Int64:
+		GetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetInt64);
+		break;
+	case EUIDatasourceValueType::Double:
+		GetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, GetDouble);
+		break;
 	case EUIDatasourceValueType::Archetype:
 	case EUIDatasourceValueType::Void:
 		checkf(false, TEXT("No possible getter function for descriptor type %d"), Descriptor.Type);
@@ -148,6 +175,18 @@ FMemberReference UIDatasourceEditorHelpers::GetSetterFunctionForDescriptor(const
 	case EUIDatasourceValueType::Struct:
 		SetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, SetStruct);
 		break;
+	case EUIDatasourceValueType::Vector2D:
+		SetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, SetVector2D);
+		break;
+	case EUIDatasourceValueType::LinearColor:
+		SetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, SetLinearColor);
+		break;
+	case EUIDatasourceValueType::Int64:
+		SetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, SetInt64);
+		break;
+	case EUIDatasourceValueType::Double:
+		SetDatasourceValueFunctionName = GET_FUNCTION_NAME_CHECKED(UUIDatasourceBlueprintLibrary, SetDouble);
+		break;
 	case EUIDatasourceValueType::Archetype:
 	case EUIDatasourceValueType::Void:
 		checkf(false, TEXT("No possible setter function for descriptor type %d"), Descriptor.Type);
@@ -4,6 +4,9 @@
 
 #include "K2Node_UIDatasourceSingleBinding.h"
 #include "UIDatasourceUserWidgetExtension.h"
+#include "WidgetBlueprintCompiler.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/TextBlock.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(UIDatasourceWidgetBlueprintExtension)
 
@@ -46,6 +49,59 @@ void UUIDatasourceWidgetBlueprintExtension::HandleFinishCompilingClass(UWidgetBl
 			}
 		}
 
+		for (const FUIDatasourceFormatBinding& FormatBinding : FormatBindings)
+		{
+			const UWidget* Widget = WidgetBP->WidgetTree ? WidgetBP->WidgetTree->FindWidget(FormatBinding.TextBlock) : nullptr;
+			if (!Cast<UTextBlock>(Widget))
+			{
+				CurrentContext->MessageLog.Error(*FString::Printf(TEXT("Format binding target %s isn't a text block of this widget."), *FormatBinding.TextBlock.ToString()));
+				continue;
+			}
+
+			FUIDataFormatBindTemplate Template;
+			Template.TextBlockName = FormatBinding.TextBlock;
+			Template.Format = FormatBinding.Format;
+			Template.BindType = FormatBinding.BindType;
+			FTextFormat(FormatBinding.Format).GetFormatArgumentNames(Template.Arguments);
+			for (const FString& Argument : Template.Arguments)
+			{
+				if (Argument.Contains(TEXT(":")))
+				{
+					CurrentContext->MessageLog.Warning(*FString::Printf(TEXT("Format binding on %s uses the struct field argument {%s}, which isn't supported and will format as empty."), *FormatBinding.TextBlock.ToString(), *Argument));
+				}
+			}
+			UIDatasourceExtension->FormatBindings.Add(MoveTemp(Template));
+		}
+
+		for (const FUIDatasourcePropertyBinding& PropertyBinding : PropertyBindings)
+		{
+			const UWidget* Widget = WidgetBP->WidgetTree ? WidgetBP->WidgetTree->FindWidget(PropertyBinding.Widget) : nullptr;
+			const FProperty* Property = Widget ? FindFProperty<FProperty>(Widget->GetClass(), PropertyBinding.Property) : nullptr;
+			if (!Property)
+			{
+				CurrentContext->MessageLog.Error(*FString::Printf(TEXT("Property binding target %s.%s doesn't exist in this widget."), *PropertyBinding.Widget.ToString(), *PropertyBinding.Property.ToString()));
+				continue;
+			}
+			if (!FUIDatasourcePropertyBinder::IsCompatible(Property, PropertyBinding.Conversion))
+			{
+				CurrentContext->MessageLog.Error(*FString::Printf(TEXT("Property binding target %s.%s can't receive values with the %s conversion."), *PropertyBinding.Widget.ToString(), *PropertyBinding.Property.ToString(), *UEnum::GetValueAsString(PropertyBinding.Conversion)));
+				continue;
+			}
+			if (PropertyBinding.Path.Contains(TEXT(":")))
+			{
+				CurrentContext->MessageLog.Error(*FString::Printf(TEXT("Property binding on %s.%s uses a struct field path, which isn't supported."), *PropertyBinding.Widget.ToString(), *PropertyBinding.Property.ToString()));
+				continue;
+			}
+
+			FUIDataPropertyBindTemplate Template;
+			Template.WidgetName = PropertyBinding.Widget;
+			Template.PropertyName = PropertyBinding.Property;
+			Template.Path = PropertyBinding.Path;
+			Template.BindType = PropertyBinding.BindType;
+			Template.Conversion = PropertyBinding.Conversion;
+			UIDatasourceExtension->PropertyBindings.Add(MoveTemp(Template));
+		}
+
 	}
 }
 
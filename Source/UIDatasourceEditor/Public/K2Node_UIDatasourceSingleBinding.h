@@ -19,6 +19,10 @@ public:
 	void CreateProperlyTypedModelOutputPin();
 	virtual void AllocateDefaultPins() override;
 	FName GetGeneratedEventName() const;
+	// Field part of a Path:Field binding, None for bindings on the whole value
+	FName GetField() const;
+	// Property a field binding points to inside FieldStruct, null if it doesn't exist or the binding isn't a field binding
+	const FProperty* FindFieldProperty() const;
 	bool CheckForErrors(const FKismetCompilerContext& CompilerContext) const;
 	virtual void ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
 	virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
@@ -31,7 +35,7 @@ public:
 	virtual FLinearColor GetNodeTitleColor() const override;
 
 public:
-	// Datasource path, relative to the BindType
+	// Datasource path, relative to the BindType. Path:Field binds to a property inside the struct value (e.g. Stats:Armor.Value)
 	UPROPERTY(EditAnywhere)
 	FString Path;
 
@@ -55,6 +59,10 @@ public:
 	UPROPERTY(EditAnywhere, meta=(EditCondition="Type==EUIDatasourceValueType::Image", EditConditionHides))
 	EUIDatasourceImageType ImageType;
 
+	// Struct held by the datasource, types the output pin of field bindings
+	UPROPERTY(EditAnywhere, meta=(EditCondition="Type==EUIDatasourceValueType::Struct", EditConditionHides))
+	TObjectPtr<const UScriptStruct> FieldStruct;
+
 	// Source Archetype, more for debugging purposes
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<const UUIDatasourceArchetype> SourceArchetype;
@@ -2,12 +2,55 @@
 
 #pragma once
 
+#include "UIDatasourceUserWidgetExtension.h"
 #include "WidgetBlueprintExtension.h"
 
 #include "UIDatasourceWidgetBlueprintExtension.generated.h"
 
 class UUIDatasourceArchetype;
 
+// Text block driven by a format string over datasource values, replaces Format Text graphs in bindings callbacks
+USTRUCT()
+struct FUIDatasourceFormatBinding
+{
+	GENERATED_BODY()
+
+	// Name of the text block in the widget tree receiving the formatted text
+	UPROPERTY(EditAnywhere)
+	FName TextBlock;
+
+	// Text format where each argument is a datasource path, e.g. {Gold} / {MaxGold}
+	UPROPERTY(EditAnywhere)
+	FText Format;
+
+	UPROPERTY(EditAnywhere)
+	EDatasourceBindType BindType = EDatasourceBindType::Self;
+};
+
+// Widget property written natively from a datasource value, replaces bindings whose callback only calls a setter
+USTRUCT()
+struct FUIDatasourcePropertyBinding
+{
+	GENERATED_BODY()
+
+	// Name of the widget in the widget tree owning the property
+	UPROPERTY(EditAnywhere)
+	FName Widget;
+
+	// Property of the widget receiving the value, e.g. Text, Visibility or Percent
+	UPROPERTY(EditAnywhere)
+	FName Property;
+
+	UPROPERTY(EditAnywhere)
+	FString Path;
+
+	UPROPERTY(EditAnywhere)
+	EDatasourceBindType BindType = EDatasourceBindType::Self;
+
+	UPROPERTY(EditAnywhere)
+	EUIDatasourcePropertyConversion Conversion = EUIDatasourcePropertyConversion::Direct;
+};
+
 UCLASS()
 class UUIDatasourceWidgetBlueprintExtension : public UWidgetBlueprintExtension
 {
@@ -27,6 +70,14 @@ public:
 	UPROPERTY(EditAnywhere)
 	TObjectPtr<UUIDatasourceArchetype> Archetype;
 
+	// Format strings compiled with the blueprint, each re-formats its text block once per flush if any of its inputs changed
+	UPROPERTY(EditAnywhere, meta=(TitleProperty="TextBlock"))
+	TArray<FUIDatasourceFormatBinding> FormatBindings;
+
+	// Datasource values written straight in widget properties, without going through a blueprint event
+	UPROPERTY(EditAnywhere, meta=(TitleProperty="{Widget}.{Property} = {Path}"))
+	TArray<FUIDatasourcePropertyBinding> PropertyBindings;
+
 private:
 	FWidgetBlueprintCompilerContext* CurrentContext;
 };